@@ -0,0 +1,63 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace FirstPersonController
+{
+    // Moves character controllers directly to positions whose floor height was found with a sweep
+    // and whose capsule volume was verified to be clear with an overlap query
+    class CharacterTeleportRequests
+    {
+    public:
+        AZ_RTTI(CharacterTeleportRequests, "{c47e2a9d-1f58-4b63-9e0c-8a3d5f6b2071}");
+        virtual ~CharacterTeleportRequests() = default;
+
+        // Teleports the character so that its feet rest on the floor found near position, returns false if the spot is blocked
+        virtual bool Teleport(const AZ::EntityId& entityId, const AZ::Vector3& position) = 0;
+        // Teleports each character to the position at the same index, using one batched sweep query and one batched overlap
+        // query for all of them. Returns the characters that were moved, the others were left in place.
+        virtual AZStd::vector<AZ::EntityId> TeleportMany(const AZStd::vector<AZ::EntityId>& entityIds, const AZStd::vector<AZ::Vector3>& positions) = 0;
+        // Distance above and below the requested position that is searched for the floor
+        virtual float GetTeleportProbeHeight() const = 0;
+        virtual void SetTeleportProbeHeight(const float& probeHeight) = 0;
+        // Gap left between the floor and the bottom of the capsule
+        virtual float GetTeleportSkinWidth() const = 0;
+        virtual void SetTeleportSkinWidth(const float& skinWidth) = 0;
+    };
+
+    class CharacterTeleportBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        //////////////////////////////////////////////////////////////////////////
+    };
+
+    using CharacterTeleportRequestBus = AZ::EBus<CharacterTeleportRequests, CharacterTeleportBusTraits>;
+    using CharacterTeleportInterface = AZ::Interface<CharacterTeleportRequests>;
+
+    // Requests addressed by the teleporter volume entity
+    class TeleporterComponentRequests : public AZ::ComponentBus
+    {
+    public:
+        ~TeleporterComponentRequests() override = default;
+
+        virtual AZ::EntityId GetDestinationEntityId() const = 0;
+        virtual void SetDestinationEntityId(const AZ::EntityId&) = 0;
+        virtual bool GetMatchDestinationHeading() const = 0;
+        virtual void SetMatchDestinationHeading(const bool&) = 0;
+    };
+
+    using TeleporterComponentRequestBus = AZ::EBus<TeleporterComponentRequests>;
+} // namespace FirstPersonController
@@ -6,6 +6,9 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
 
 namespace FirstPersonController
 {
@@ -14,7 +17,31 @@ namespace FirstPersonController
     public:
         AZ_RTTI(FirstPersonControllerRequests, "{2880DB3D-3966-4C87-8777-BC9028E3F48D}");
         virtual ~FirstPersonControllerRequests() = default;
-        // Put your public methods here
+
+        // Called once per tick by each First Person Controller with LOD enabled, used to count the controllers at each LOD tier
+        virtual void ReportLodTier(const LodTier& tier) = 0;
+        // Called by each First Person Controller with LOD enabled whenever it runs a movement step at its current LOD tier
+        virtual void ReportLodStep(const LodTier& tier) = 0;
+        // Number of controllers that were at each LOD tier during the last tick
+        virtual AZStd::vector<AZ::u32> GetLodTierControllerCounts() const = 0;
+        // Number of movement steps that were run at each LOD tier during the last tick
+        virtual AZStd::vector<AZ::u32> GetLodTierStepCounts() const = 0;
+        // Number of registered kinematic movers and how many of them are currently moving
+        virtual AZ::u32 GetKinematicMoverCount() const = 0;
+        virtual AZ::u32 GetActiveKinematicMoverCount() const = 0;
+        // Whether the scene queries of the controllers' steps run on job-system workers, one job per physics scene
+        // or one job per Controllers Per Job controllers when that is nonzero. Only the queries are moved off the calling
+        // thread, the rest of every step stays serial, so any gain is bounded by the query phase's share of the step.
+        virtual bool GetParallelSceneStepping() const = 0;
+        virtual void SetParallelSceneStepping(const bool& parallelSceneStepping) = 0;
+        virtual AZ::u32 GetControllersPerJob() const = 0;
+        virtual void SetControllersPerJob(const AZ::u32& controllersPerJob) = 0;
+        // Wall time of the query phase and of the serial phases of the last tick's controller steps
+        virtual AZ::u32 GetLastQueryPhaseMicroseconds() const = 0;
+        virtual AZ::u32 GetLastSerialPhaseMicroseconds() const = 0;
+        // Number of physics scenes with scheduled controllers and the number of scheduled controllers
+        virtual AZ::u32 GetSteppedSceneCount() const = 0;
+        virtual AZ::u32 GetSteppedControllerCount() const = 0;
     };
     
     class FirstPersonControllerBusTraits
@@ -6,12 +6,65 @@
 
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Vector3.h>
 
+#include <FirstPersonController/InputOverride.h>
+#include <FirstPersonController/LodTier.h>
+
 #include <AzFramework/Physics/PhysicsScene.h>
 
 namespace FirstPersonController
 {
+    // The most used controller values, read with GetStateSnapshot and written with ApplyStateOverrides
+    // so that a script can exchange them in one request rather than one request per value.
+    // The values from Grounded on are read only and are ignored by ApplyStateOverrides.
+    struct FirstPersonControllerState
+    {
+        AZ_TYPE_INFO(FirstPersonControllerState, "{7d3b52e8-a1c4-4f96-b08d-3e6c9f21a547}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // Input values
+        float m_forwardValue = 0.f;
+        float m_backValue = 0.f;
+        float m_leftValue = 0.f;
+        float m_rightValue = 0.f;
+        float m_yawValue = 0.f;
+        float m_pitchValue = 0.f;
+        float m_sprintValue = 0.f;
+        float m_crouchValue = 0.f;
+        float m_jumpValue = 0.f;
+
+        // Direction scales and camera sensitivities
+        float m_forwardScale = 1.f;
+        float m_backScale = 0.75f;
+        float m_leftScale = 1.f;
+        float m_rightScale = 1.f;
+        float m_yawSensitivity = 0.0035f;
+        float m_pitchSensitivity = 0.0035f;
+
+        // Movement
+        float m_topWalkSpeed = 5.f;
+        float m_gravity = -30.f;
+        float m_jumpInitialVelocity = 6.f;
+        AZ::Vector2 m_applyVelocityXY = AZ::Vector2::CreateZero();
+        float m_applyVelocityZ = 0.f;
+        AZ::Vector3 m_addVelocityWorld = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_addVelocityHeading = AZ::Vector3::CreateZero();
+
+        // Read only state
+        bool m_grounded = false;
+        bool m_groundClose = false;
+        float m_airTime = 0.f;
+        float m_heading = 0.f;
+        float m_pitch = 0.f;
+        bool m_crouched = false;
+        bool m_sprinting = false;
+        float m_staminaPercentage = 0.f;
+        bool m_climbingLadder = false;
+    };
+
     class FirstPersonControllerComponentRequests : public AZ::ComponentBus
     {
     public:
@@ -293,10 +346,87 @@ namespace FirstPersonController
         virtual float GetHeading() const = 0;
         virtual void SetHeadingForTick(const float&) = 0;
         virtual float GetPitch() const = 0;
+        virtual bool GetLodEnabled() const = 0;
+        virtual void SetLodEnabled(const bool&) = 0;
+        virtual float GetLodReducedDistance() const = 0;
+        virtual void SetLodReducedDistance(const float&) = 0;
+        virtual float GetLodMinimalDistance() const = 0;
+        virtual void SetLodMinimalDistance(const float&) = 0;
+        virtual AZ::u32 GetLodReducedStepInterval() const = 0;
+        virtual void SetLodReducedStepInterval(const AZ::u32&) = 0;
+        virtual AZ::u32 GetLodMinimalStepInterval() const = 0;
+        virtual void SetLodMinimalStepInterval(const AZ::u32&) = 0;
+        virtual AZ::u8 GetLodTier() const = 0;
+        virtual float GetCapsuleResizeQuantum() const = 0;
+        virtual void SetCapsuleResizeQuantum(const float&) = 0;
+        virtual AZ::u32 GetCapsuleResizesSavedLastTransition() const = 0;
+        virtual bool GetLookInputRedirected() const = 0;
+        virtual void SetLookInputRedirected(const bool&) = 0;
+        // Yaw (X) and pitch (Y) rotation in radians produced by the gamepad's right stick on the last tick
+        virtual AZ::Vector2 GetGamepadLookDelta() const = 0;
+        virtual bool GetInheritPlatformVelocity() const = 0;
+        virtual void SetInheritPlatformVelocity(const bool&) = 0;
+        virtual bool GetPlatformRotationTurnsCharacter() const = 0;
+        virtual void SetPlatformRotationTurnsCharacter(const bool&) = 0;
+        virtual AZ::EntityId GetPlatformEntityId() const = 0;
+        virtual AZ::Vector3 GetPlatformVelocity() const = 0;
+        virtual void EnterLadder(const AZ::EntityId&) = 0;
+        virtual void ExitLadder(const AZ::EntityId&) = 0;
+        virtual bool GetClimbingLadder() const = 0;
+        virtual AZ::EntityId GetLadderEntityId() const = 0;
+        virtual bool GetLadderClimbingEnabled() const = 0;
+        virtual void SetLadderClimbingEnabled(const bool&) = 0;
+        virtual float GetLadderClimbSpeed() const = 0;
+        virtual void SetLadderClimbSpeed(const float&) = 0;
+        virtual float GetLadderStrafeScale() const = 0;
+        virtual void SetLadderStrafeScale(const float&) = 0;
+        virtual float GetLadderLookDownAngle() const = 0;
+        virtual void SetLadderLookDownAngle(const float&) = 0;
+        virtual float GetLadderJumpOffSpeed() const = 0;
+        virtual void SetLadderJumpOffSpeed(const float&) = 0;
+        virtual bool Teleport(const AZ::Vector3&) = 0;
+        virtual void ResetVelocity() = 0;
+        virtual void Launch(const AZ::Vector3&) = 0;
+        virtual bool GetAlwaysQuerySceneCasts() const = 0;
+        virtual void SetAlwaysQuerySceneCasts(const bool&) = 0;
+        virtual AZ::u32 GetIssuedSceneCastsPerSecond() const = 0;
+        virtual AZ::u32 GetSkippedSceneCastsPerSecond() const = 0;
+        virtual AZStd::string GetQuerySceneName() const = 0;
+        virtual void SetQuerySceneName(const AZStd::string&) = 0;
+        virtual bool GetBroadcastNotifications() const = 0;
+        virtual void SetBroadcastNotifications(const bool&) = 0;
+        virtual FirstPersonControllerState GetStateSnapshot() const = 0;
+        virtual void ApplyStateOverrides(const FirstPersonControllerState&) = 0;
+        virtual AZ::u32 PushInputOverride(const InputOverride&) = 0;
+        virtual bool PopInputOverride(const AZ::u32&) = 0;
+        virtual void ClearInputOverrides() = 0;
+        virtual AZ::u32 GetInputOverrideCount() const = 0;
+        virtual bool GetGamepadEnabled() const = 0;
+        virtual void SetGamepadEnabled(const bool&) = 0;
+        virtual float GetGamepadInnerDeadZone() const = 0;
+        virtual void SetGamepadInnerDeadZone(const float&) = 0;
+        virtual float GetGamepadOuterDeadZone() const = 0;
+        virtual void SetGamepadOuterDeadZone(const float&) = 0;
+        virtual float GetGamepadMoveResponseExponent() const = 0;
+        virtual void SetGamepadMoveResponseExponent(const float&) = 0;
+        virtual float GetGamepadLookResponseExponent() const = 0;
+        virtual void SetGamepadLookResponseExponent(const float&) = 0;
+        virtual float GetGamepadLookYawSpeed() const = 0;
+        virtual void SetGamepadLookYawSpeed(const float&) = 0;
+        virtual float GetGamepadLookPitchSpeed() const = 0;
+        virtual void SetGamepadLookPitchSpeed(const float&) = 0;
+        virtual float GetGamepadLookAccelerationScale() const = 0;
+        virtual void SetGamepadLookAccelerationScale(const float&) = 0;
+        virtual float GetGamepadLookAccelerationTime() const = 0;
+        virtual void SetGamepadLookAccelerationTime(const float&) = 0;
+        virtual AZ::u32 GetReceivedInputEventsPerSecond() const = 0;
+        virtual AZ::u32 GetChangedInputEventsPerSecond() const = 0;
     };
 
     using FirstPersonControllerComponentRequestBus = AZ::EBus<FirstPersonControllerComponentRequests>;
 
+    // Notifications broadcast to every handler by default, or addressed by the controller entity when its Broadcast Notifications is disabled,
+    // sent once the step that raised them is done
     class FirstPersonControllerNotifications
         : public AZ::ComponentBus
     {
@@ -325,6 +455,8 @@ namespace FirstPersonController
         virtual void OnSprintStarted() = 0;
         virtual void OnCooldownStarted() = 0;
         virtual void OnCooldownDone() = 0;
+        virtual void OnStartedClimbing() = 0;
+        virtual void OnStoppedClimbing() = 0;
     };
 
     using FirstPersonControllerNotificationBus = AZ::EBus<FirstPersonControllerNotifications>;
@@ -336,7 +468,7 @@ namespace FirstPersonController
     public:
         AZ_EBUS_BEHAVIOR_BINDER(FirstPersonControllerNotificationHandler,
             "{b6d9e703-2c1b-4282-81a9-249123f3eee8}",
-            AZ::SystemAllocator, OnGroundHit, OnGroundSoonHit, OnUngrounded, OnStartedFalling, OnStartedMoving, OnTargetVelocityReached, OnStopped, OnTopWalkSpeedReached, OnTopSprintSpeedReached, OnHeadHit, OnHitSomething, OnGravityPrevented, OnCrouched, OnStoodUp, OnStandPrevented, OnStartedCrouching, OnStartedStanding, OnFirstJump, OnSecondJump, OnStaminaCapped, OnStaminaReachedZero, OnSprintStarted, OnCooldownStarted, OnCooldownDone);
+            AZ::SystemAllocator, OnGroundHit, OnGroundSoonHit, OnUngrounded, OnStartedFalling, OnStartedMoving, OnTargetVelocityReached, OnStopped, OnTopWalkSpeedReached, OnTopSprintSpeedReached, OnHeadHit, OnHitSomething, OnGravityPrevented, OnCrouched, OnStoodUp, OnStandPrevented, OnStartedCrouching, OnStartedStanding, OnFirstJump, OnSecondJump, OnStaminaCapped, OnStaminaReachedZero, OnSprintStarted, OnCooldownStarted, OnCooldownDone, OnStartedClimbing, OnStoppedClimbing);
 
         void OnGroundHit() override
         {
@@ -434,5 +566,13 @@ namespace FirstPersonController
         {
             Call(FN_OnCooldownDone);
         }
+        void OnStartedClimbing() override
+        {
+            Call(FN_OnStartedClimbing);
+        }
+        void OnStoppedClimbing() override
+        {
+            Call(FN_OnStoppedClimbing);
+        }
     };
 } // namespace FirstPersonController
@@ -0,0 +1,89 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace FirstPersonController
+{
+    // The autonomous role predicts its own movement and sends its input to the authority,
+    // the authority runs the same movement step and sends back the resulting state
+    enum class NetworkRole : AZ::u8
+    {
+        Autonomous = 0,
+        Authority
+    };
+
+    // Input frame sent from the autonomous controller to the authority each tick. m_data holds the tick's input values
+    // and the heading the controller moved along, bit-packed by the controller snapshot serializer.
+    struct InputFrame
+    {
+        AZ::u16 m_sequence = 0;
+        AZStd::vector<AZ::u8> m_data;
+
+        // Size of the frame on the wire
+        AZ::u32 GetWireSize() const
+        {
+            return 2 + static_cast<AZ::u32>(m_data.size());
+        }
+    };
+
+    // Authoritative state sent from the authority back to the autonomous controller,
+    // m_ackSequence is the sequence of the last input frame the authority has stepped
+    struct StateFrame
+    {
+        AZ::u16 m_ackSequence = 0;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZ::Vector2 m_applyVelocityXY = AZ::Vector2::CreateZero();
+        float m_applyVelocityZ = 0.f;
+
+        // Size of the frame on the wire
+        static constexpr AZ::u32 WireSize = 2 + 12 + 8 + 4;
+    };
+
+    // Returns true when sequence a is more recent than sequence b, accounting for wrap around
+    inline bool SequenceMoreRecent(const AZ::u16& a, const AZ::u16& b)
+    {
+        return static_cast<AZ::s16>(a - b) > 0;
+    }
+
+    class FirstPersonControllerNetworkComponentRequests : public AZ::ComponentBus
+    {
+    public:
+        ~FirstPersonControllerNetworkComponentRequests() override = default;
+
+        virtual AZ::u8 GetNetworkRole() const = 0;
+        virtual AZ::EntityId GetPeerEntityId() const = 0;
+        virtual void SetPeerEntityId(const AZ::EntityId&) = 0;
+        virtual AZ::u32 GetLoopbackLatencyTicks() const = 0;
+        virtual void SetLoopbackLatencyTicks(const AZ::u32&) = 0;
+        virtual float GetCorrectionTolerance() const = 0;
+        virtual void SetCorrectionTolerance(const float&) = 0;
+        virtual AZ::u32 GetBytesSentPerSecond() const = 0;
+        virtual AZ::u32 GetBytesReceivedPerSecond() const = 0;
+        virtual AZ::u32 GetCorrectionCount() const = 0;
+        virtual AZ::u32 GetReplayedInputCount() const = 0;
+        virtual float GetLastRollbackMicroseconds() const = 0;
+        virtual float GetMaxRollbackMicroseconds() const = 0;
+        virtual AZ::u32 GetUnacknowledgedInputCount() const = 0;
+        virtual void ResetNetworkCounters() = 0;
+    };
+
+    using FirstPersonControllerNetworkComponentRequestBus = AZ::EBus<FirstPersonControllerNetworkComponentRequests>;
+
+    // Transport bus addressed by the receiving entity. The network component's loopback sends through this bus,
+    // a replication layer can deliver the frames it receives on the network through the same events.
+    class FirstPersonControllerNetworkTransportNotifications : public AZ::ComponentBus
+    {
+    public:
+        virtual void OnInputFrameReceived(const InputFrame&) = 0;
+        virtual void OnStateFrameReceived(const StateFrame&) = 0;
+    };
+
+    using FirstPersonControllerNetworkTransportNotificationBus = AZ::EBus<FirstPersonControllerNetworkTransportNotifications>;
+} // namespace FirstPersonController
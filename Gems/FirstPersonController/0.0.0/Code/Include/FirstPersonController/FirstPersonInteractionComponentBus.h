@@ -0,0 +1,80 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+
+namespace FirstPersonController
+{
+    class FirstPersonInteractionComponentRequests : public AZ::ComponentBus
+    {
+    public:
+        ~FirstPersonInteractionComponentRequests() override = default;
+
+        virtual AZ::EntityId GetFocusedEntityId() const = 0;
+        virtual void Interact() = 0;
+        virtual float GetInteractDistance() const = 0;
+        virtual void SetInteractDistance(const float&) = 0;
+        virtual AZStd::string GetInteractableTag() const = 0;
+        virtual void SetInteractableTag(const AZStd::string&) = 0;
+        virtual AZ::u32 GetCastTickInterval() const = 0;
+        virtual void SetCastTickInterval(const AZ::u32&) = 0;
+        virtual AZStd::string GetInteractEventName() const = 0;
+        virtual void SetInteractEventName(const AZStd::string&) = 0;
+        virtual AZStd::string GetInteractCollisionGroupName() const = 0;
+        virtual void SetInteractCollisionGroupByName(const AZStd::string&) = 0;
+        virtual float GetInteractHoldTime() const = 0;
+        virtual void SetInteractHoldTime(const float&) = 0;
+        virtual float GetInteractProgress() const = 0;
+        virtual AZ::u32 GetInteractionEventsPerSecond() const = 0;
+        virtual AZ::u32 GetPerTickEquivalentEventsPerSecond() const = 0;
+    };
+
+    using FirstPersonInteractionComponentRequestBus = AZ::EBus<FirstPersonInteractionComponentRequests>;
+
+    // Notifications sent only when the focus changes or on interaction. Each event is addressed by the interacting (player)
+    // entity with the interactable entity as its argument, and by the interactable entity with the player entity as its argument.
+    class InteractionNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        virtual void OnFocusGained(const AZ::EntityId&) = 0;
+        virtual void OnFocusLost(const AZ::EntityId&) = 0;
+        virtual void OnInteract(const AZ::EntityId&) = 0;
+        // Progress is between zero and one while the interact key is held, it is only sent when the Interact Hold Time is non-zero.
+        // Zero is sent when the key is released, when the hold completes, and to the entity losing focus when the focus changes.
+        virtual void OnInteractProgress(const AZ::EntityId&, const float&) = 0;
+    };
+
+    using InteractionNotificationBus = AZ::EBus<InteractionNotifications>;
+
+    class InteractionNotificationHandler
+        : public InteractionNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        AZ_EBUS_BEHAVIOR_BINDER(InteractionNotificationHandler,
+            "{4d1c8a73-6e29-4f0b-b5d2-93a7e1c04f58}",
+            AZ::SystemAllocator, OnFocusGained, OnFocusLost, OnInteract, OnInteractProgress);
+
+        void OnFocusGained(const AZ::EntityId& entityId) override
+        {
+            Call(FN_OnFocusGained, entityId);
+        }
+        void OnFocusLost(const AZ::EntityId& entityId) override
+        {
+            Call(FN_OnFocusLost, entityId);
+        }
+        void OnInteract(const AZ::EntityId& entityId) override
+        {
+            Call(FN_OnInteract, entityId);
+        }
+        void OnInteractProgress(const AZ::EntityId& entityId, const float& progress) override
+        {
+            Call(FN_OnInteractProgress, entityId, progress);
+        }
+    };
+} // namespace FirstPersonController
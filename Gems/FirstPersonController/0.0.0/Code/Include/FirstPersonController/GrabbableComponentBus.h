@@ -0,0 +1,91 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+
+namespace FirstPersonController
+{
+    // Requests addressed by the grabbable entity
+    class GrabbableComponentRequests : public AZ::ComponentBus
+    {
+    public:
+        ~GrabbableComponentRequests() override = default;
+
+        virtual bool GetIsHeld() const = 0;
+        virtual AZ::EntityId GetHolderEntityId() const = 0;
+        virtual bool GetInspectable() const = 0;
+        virtual void SetInspectable(const bool&) = 0;
+        virtual float GetFollowRate() const = 0;
+        virtual void SetFollowRate(const float&) = 0;
+        virtual float GetMaxFollowSpeed() const = 0;
+        virtual void SetMaxFollowSpeed(const float&) = 0;
+
+        // Used by the carry system when it picks up and drops the entity
+        virtual void OnPickedUp(const AZ::EntityId& holderEntityId) = 0;
+        virtual void OnDropped(const bool& thrown) = 0;
+    };
+
+    using GrabbableComponentRequestBus = AZ::EBus<GrabbableComponentRequests>;
+
+    // Notifications addressed by the grabbable entity
+    class GrabbableNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        virtual void OnGrabbed(const AZ::EntityId&) = 0;
+        virtual void OnReleased(const AZ::EntityId&) = 0;
+        virtual void OnThrown(const AZ::EntityId&) = 0;
+    };
+
+    using GrabbableNotificationBus = AZ::EBus<GrabbableNotifications>;
+
+    class GrabbableNotificationHandler
+        : public GrabbableNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        AZ_EBUS_BEHAVIOR_BINDER(GrabbableNotificationHandler,
+            "{1f6d8b42-c37a-4e09-b5a1-d48e62c7f915}",
+            AZ::SystemAllocator, OnGrabbed, OnReleased, OnThrown);
+
+        void OnGrabbed(const AZ::EntityId& holderEntityId) override
+        {
+            Call(FN_OnGrabbed, holderEntityId);
+        }
+        void OnReleased(const AZ::EntityId& holderEntityId) override
+        {
+            Call(FN_OnReleased, holderEntityId);
+        }
+        void OnThrown(const AZ::EntityId& holderEntityId) override
+        {
+            Call(FN_OnThrown, holderEntityId);
+        }
+    };
+
+    // Requests addressed by the carrying (player) entity
+    class FirstPersonCarryComponentRequests : public AZ::ComponentBus
+    {
+    public:
+        ~FirstPersonCarryComponentRequests() override = default;
+
+        virtual AZ::EntityId GetHeldEntityId() const = 0;
+        virtual bool Grab(const AZ::EntityId&) = 0;
+        virtual void Release() = 0;
+        virtual void Throw() = 0;
+        virtual bool GetIsInspecting() const = 0;
+        virtual float GetHoldDistance() const = 0;
+        virtual void SetHoldDistance(const float&) = 0;
+        virtual float GetBreakDistance() const = 0;
+        virtual void SetBreakDistance(const float&) = 0;
+        virtual float GetThrowSpeed() const = 0;
+        virtual void SetThrowSpeed(const float&) = 0;
+        virtual float GetInspectSensitivity() const = 0;
+        virtual void SetInspectSensitivity(const float&) = 0;
+    };
+
+    using FirstPersonCarryComponentRequestBus = AZ::EBus<FirstPersonCarryComponentRequests>;
+} // namespace FirstPersonController
@@ -0,0 +1,29 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+
+namespace FirstPersonController
+{
+    // Requests addressed by the impulse pad entity
+    class ImpulsePadComponentRequests : public AZ::ComponentBus
+    {
+    public:
+        ~ImpulsePadComponentRequests() override = default;
+
+        virtual float GetApexHeight() const = 0;
+        virtual void SetApexHeight(const float&) = 0;
+        virtual float GetRestitution() const = 0;
+        virtual void SetRestitution(const float&) = 0;
+        virtual float GetMaxLaunchSpeed() const = 0;
+        virtual void SetMaxLaunchSpeed(const float&) = 0;
+        virtual bool GetAffectsRigidBodies() const = 0;
+        virtual void SetAffectsRigidBodies(const bool&) = 0;
+    };
+
+    using ImpulsePadComponentRequestBus = AZ::EBus<ImpulsePadComponentRequests>;
+} // namespace FirstPersonController
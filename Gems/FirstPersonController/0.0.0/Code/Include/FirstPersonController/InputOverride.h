@@ -0,0 +1,57 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/RTTI/TypeInfo.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace FirstPersonController
+{
+    // Input values an input override can replace, as bits of its mask
+    enum class InputOverrideChannel : AZ::u32
+    {
+        Forward = 1 << 0,
+        Back = 1 << 1,
+        Left = 1 << 2,
+        Right = 1 << 3,
+        Yaw = 1 << 4,
+        Pitch = 1 << 5,
+        Sprint = 1 << 6,
+        Crouch = 1 << 7,
+        Jump = 1 << 8
+    };
+
+    static constexpr AZ::u32 InputOverrideChannelCount = 9;
+    static constexpr AZ::u32 InputOverrideAllChannels = (1u << InputOverrideChannelCount) - 1;
+
+    // Replaces the masked input values of a controller while it is on the controller's input override stack.
+    // The highest priority override wins for each channel, and the most recently pushed one among equal priorities.
+    // A tick count of 0 keeps the override until it is popped.
+    struct InputOverride
+    {
+        AZ_TYPE_INFO(InputOverride, "{e5a0c3f7-4b1d-4e86-9a27-6c8d1f3b5e40}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        AZ::s32 m_priority = 0;
+        AZ::u32 m_mask = InputOverrideAllChannels;
+        AZ::u32 m_ticks = 0;
+
+        float m_forwardValue = 0.f;
+        float m_backValue = 0.f;
+        float m_leftValue = 0.f;
+        float m_rightValue = 0.f;
+        float m_yawValue = 0.f;
+        float m_pitchValue = 0.f;
+        float m_sprintValue = 0.f;
+        float m_crouchValue = 0.f;
+        float m_jumpValue = 0.f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,49 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace FirstPersonController
+{
+    // Registry of interactable entity positions, queried without physics casts. Entities are fed to it by the Interactable
+    // component, which registers its entity on activation and follows its transform, rather than by scanning for entities with
+    // the interaction component's tag; an entity has to carry the Interactable component to be found by these queries.
+    class InteractableRegistryRequests
+    {
+    public:
+        AZ_RTTI(InteractableRegistryRequests, "{5e3b9c1a-84d7-4f20-a6c9-0d7e2b41f853}");
+        virtual ~InteractableRegistryRequests() = default;
+
+        // Registers the entity at position, or moves it if it is already registered
+        virtual void RegisterInteractable(const AZ::EntityId& entityId, const AZ::Vector3& position) = 0;
+        virtual void UnregisterInteractable(const AZ::EntityId& entityId) = 0;
+        // Interactables within radius of center
+        virtual AZStd::vector<AZ::EntityId> QueryInteractablesInRadius(const AZ::Vector3& center, const float& radius) const = 0;
+        // Interactables within maxDistance of origin and halfAngleDegrees of direction
+        virtual AZStd::vector<AZ::EntityId> QueryInteractablesInCone(
+            const AZ::Vector3& origin, const AZ::Vector3& direction, const float& maxDistance, const float& halfAngleDegrees) const = 0;
+        virtual AZ::u32 GetInteractableCount() const = 0;
+    };
+
+    class InteractableRegistryBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        //////////////////////////////////////////////////////////////////////////
+    };
+
+    using InteractableRegistryRequestBus = AZ::EBus<InteractableRegistryRequests, InteractableRegistryBusTraits>;
+    using InteractableRegistryInterface = AZ::Interface<InteractableRegistryRequests>;
+
+} // namespace FirstPersonController
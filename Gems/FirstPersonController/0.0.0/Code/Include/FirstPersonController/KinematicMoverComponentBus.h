@@ -0,0 +1,90 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+
+namespace FirstPersonController
+{
+    enum class KinematicMoverEasing : AZ::u8
+    {
+        Linear,
+        SmoothStep
+    };
+
+    // Requests addressed by the moving entity, positions are between 0 (start pose) and 1 (end pose)
+    class KinematicMoverComponentRequests : public AZ::ComponentBus
+    {
+    public:
+        ~KinematicMoverComponentRequests() override = default;
+
+        virtual void GoTo(const float&) = 0;
+        virtual void Stop() = 0;
+        virtual float GetPosition() const = 0;
+        virtual float GetTargetPosition() const = 0;
+        virtual bool GetIsMoving() const = 0;
+        virtual float GetTravelTime() const = 0;
+        virtual void SetTravelTime(const float&) = 0;
+    };
+
+    using KinematicMoverComponentRequestBus = AZ::EBus<KinematicMoverComponentRequests>;
+
+    // Notifications addressed by the moving entity
+    class KinematicMoverNotifications
+        : public AZ::ComponentBus
+    {
+    public:
+        virtual void OnMoverStarted(const float&) = 0;
+        virtual void OnMoverArrived(const float&) = 0;
+    };
+
+    using KinematicMoverNotificationBus = AZ::EBus<KinematicMoverNotifications>;
+
+    // System that owns and steps every kinematic mover, each mover is addressed by its entity
+    class KinematicMoverSystemRequests
+    {
+    public:
+        AZ_RTTI(KinematicMoverSystemRequests, "{a7d42e19-3c86-4b5f-91e0-5f2c8b6d4a73}");
+        virtual ~KinematicMoverSystemRequests() = default;
+
+        virtual void AddMover(const AZ::EntityId& entityId, const AZ::Transform& startTM, const AZ::Transform& endTM,
+            const float& travelTime, const KinematicMoverEasing& easing, const float& position) = 0;
+        virtual void RemoveMover(const AZ::EntityId& entityId) = 0;
+
+        virtual void GoTo(const AZ::EntityId& entityId, const float& targetPosition) = 0;
+        virtual void Stop(const AZ::EntityId& entityId) = 0;
+        virtual float GetPosition(const AZ::EntityId& entityId) const = 0;
+        virtual float GetTargetPosition(const AZ::EntityId& entityId) const = 0;
+        virtual bool GetIsMoving(const AZ::EntityId& entityId) const = 0;
+        virtual void SetTravelTime(const AZ::EntityId& entityId, const float& travelTime) = 0;
+
+        virtual AZ::u32 GetMoverCount() const = 0;
+        virtual AZ::u32 GetActiveMoverCount() const = 0;
+    };
+
+    using KinematicMoverSystemInterface = AZ::Interface<KinematicMoverSystemRequests>;
+
+    class KinematicMoverNotificationHandler
+        : public KinematicMoverNotificationBus::Handler
+        , public AZ::BehaviorEBusHandler
+    {
+    public:
+        AZ_EBUS_BEHAVIOR_BINDER(KinematicMoverNotificationHandler,
+            "{39d5e7a1-0c64-4b8f-a2e3-6f1b9d07c852}",
+            AZ::SystemAllocator, OnMoverStarted, OnMoverArrived);
+
+        void OnMoverStarted(const float& targetPosition) override
+        {
+            Call(FN_OnMoverStarted, targetPosition);
+        }
+        void OnMoverArrived(const float& position) override
+        {
+            Call(FN_OnMoverArrived, position);
+        }
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,27 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+
+namespace FirstPersonController
+{
+    // Requests addressed by the ladder volume entity
+    class LadderComponentRequests : public AZ::ComponentBus
+    {
+    public:
+        ~LadderComponentRequests() override = default;
+
+        virtual float GetClimbSpeedScale() const = 0;
+        virtual void SetClimbSpeedScale(const float&) = 0;
+        virtual AZ::u32 GetClimberCount() const = 0;
+        // Sent by a controller that stops climbing while still inside the volume, e.g. by jumping off.
+        // It grabs the ladder again once the controller accepts it.
+        virtual void ReleaseClimber(const AZ::EntityId&) = 0;
+    };
+
+    using LadderComponentRequestBus = AZ::EBus<LadderComponentRequests>;
+} // namespace FirstPersonController
@@ -0,0 +1,19 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace FirstPersonController
+{
+    // Level of detail tiers used to reduce the cost of controllers that are far from the active camera
+    enum class LodTier : AZ::u8
+    {
+        Full = 0,
+        Reduced,
+        Minimal,
+        Count
+    };
+} // namespace FirstPersonController
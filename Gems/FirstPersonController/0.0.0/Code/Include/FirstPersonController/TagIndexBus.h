@@ -0,0 +1,56 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace FirstPersonController
+{
+    // Cached tag to entity set and entity to tag bitmask lookups, kept up to date as tags are added and removed.
+    // A tag is indexed the first time it is queried or tracked, after which lookups don't go through the tag buses.
+    class TagIndexRequests
+    {
+    public:
+        AZ_RTTI(TagIndexRequests, "{8a2f4c67-1d3e-4b95-a07c-e5f9b3d28c41}");
+        virtual ~TagIndexRequests() = default;
+
+        // Starts indexing the tag if it isn't indexed already
+        virtual void TrackTag(const AZ::Crc32& tag) = 0;
+        virtual bool EntityHasTag(const AZ::EntityId& entityId, const AZ::Crc32& tag) = 0;
+        virtual AZStd::vector<AZ::EntityId> GetEntitiesByTag(const AZ::Crc32& tag) = 0;
+        // Returns an invalid EntityId when no entity has the tag
+        virtual AZ::EntityId GetFirstEntityByTag(const AZ::Crc32& tag) = 0;
+        // Bit i is set when the entity has the i-th tracked tag, only the first 64 tracked tags are represented
+        virtual AZ::u64 GetEntityTagMask(const AZ::EntityId& entityId) const = 0;
+        // Bit assigned to the tag in the entity tag mask, or zero if the tag isn't represented
+        virtual AZ::u64 GetTagBit(const AZ::Crc32& tag) = 0;
+
+        // Script friendly variants taking the tag name
+        virtual void TrackTagByName(const AZStd::string& tagName) = 0;
+        virtual bool EntityHasTagByName(const AZ::EntityId& entityId, const AZStd::string& tagName) = 0;
+        virtual AZStd::vector<AZ::EntityId> GetEntitiesByTagName(const AZStd::string& tagName) = 0;
+        virtual AZ::EntityId GetFirstEntityByTagName(const AZStd::string& tagName) = 0;
+    };
+
+    class TagIndexBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        //////////////////////////////////////////////////////////////////////////
+    };
+
+    using TagIndexRequestBus = AZ::EBus<TagIndexRequests, TagIndexBusTraits>;
+    using TagIndexInterface = AZ::Interface<TagIndexRequests>;
+
+} // namespace FirstPersonController
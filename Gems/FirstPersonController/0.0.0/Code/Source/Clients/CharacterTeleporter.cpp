@@ -0,0 +1,200 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/CharacterTeleporter.h>
+#include <Clients/PhysicsSceneLookup.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+#include <AzFramework/Physics/CharacterBus.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/Shape.h>
+
+#include <PhysX/CharacterControllerBus.h>
+
+namespace FirstPersonController
+{
+    AZStd::vector<AZ::EntityId> CharacterTeleporter::TeleportMany(const AZStd::vector<AZ::EntityId>& entityIds, const AZStd::vector<AZ::Vector3>& positions)
+    {
+        AZStd::vector<AZ::EntityId> movedEntityIds;
+
+        AZ_Warning("Character Teleporter", entityIds.size() == positions.size(),
+            "TeleportMany was given %zu entities and %zu positions, the extra entries are ignored.", entityIds.size(), positions.size());
+        const size_t count = AZ::GetMin(entityIds.size(), positions.size());
+        if(count == 0)
+            return movedEntityIds;
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if(sceneInterface == nullptr)
+            return movedEntityIds;
+
+        // The characters being teleported are moving away from wherever they are now, so they never block a landing
+        AZStd::unordered_set<AZ::EntityId> batchEntityIds(entityIds.begin(), entityIds.begin() + count);
+        auto castFilter = [&batchEntityIds](const AzPhysics::SimulatedBody* body, const Physics::Shape* shape)
+            {
+                if((shape != nullptr && shape->IsTrigger()) || (body != nullptr && batchEntityIds.find(body->GetEntityId()) != batchEntityIds.end()))
+                    return AzPhysics::SceneQuery::QueryHitType::None;
+                return AzPhysics::SceneQuery::QueryHitType::Block;
+            };
+        auto overlapFilter = [&batchEntityIds](const AzPhysics::SimulatedBody* body, const Physics::Shape* shape)
+            {
+                return !(shape != nullptr && shape->IsTrigger()) && !(body != nullptr && batchEntityIds.find(body->GetEntityId()) != batchEntityIds.end());
+            };
+
+        // Each character lands in the physics scene it is simulated in, the queries are batched per scene
+        AZStd::vector<Landing> landings(count);
+        AZStd::vector<AzPhysics::SceneHandle> sceneHandles;
+        for(size_t i = 0; i < count; ++i)
+        {
+            Landing& landing = landings[i];
+            landing.m_entityId = entityIds[i];
+            landing.m_position = positions[i];
+
+            if(!PhysX::CharacterControllerRequestBus::HasHandlers(landing.m_entityId))
+            {
+                AZ_Warning("Character Teleporter", false, "Entity %s has no PhysX character controller to teleport.", landing.m_entityId.ToString().c_str());
+                continue;
+            }
+            landing.m_sceneHandle = GetEntityPhysicsScene(landing.m_entityId);
+            if(landing.m_sceneHandle == AzPhysics::InvalidSceneHandle)
+            {
+                AZ_Warning("Character Teleporter", false, "Failed to retrieve the physics scene of entity %s.", landing.m_entityId.ToString().c_str());
+                continue;
+            }
+            PhysX::CharacterControllerRequestBus::EventResult(landing.m_height, landing.m_entityId,
+                &PhysX::CharacterControllerRequestBus::Events::GetHeight);
+            PhysX::CharacterControllerRequestBus::EventResult(landing.m_radius, landing.m_entityId,
+                &PhysX::CharacterControllerRequestBus::Events::GetRadius);
+            landing.m_valid = true;
+
+            if(AZStd::find(sceneHandles.begin(), sceneHandles.end(), landing.m_sceneHandle) == sceneHandles.end())
+                sceneHandles.push_back(landing.m_sceneHandle);
+        }
+
+        for(const AzPhysics::SceneHandle& sceneHandle : sceneHandles)
+        {
+            AzPhysics::SceneQueryRequests sweepRequests;
+            AZStd::vector<size_t> sweepLandings;
+            for(size_t i = 0; i < count; ++i)
+            {
+                const Landing& landing = landings[i];
+                if(!landing.m_valid || landing.m_sceneHandle != sceneHandle)
+                    continue;
+
+                // Sweep the capsule's bottom sphere down from above the requested position to find the floor
+                const AZ::Transform sweepPose = AZ::Transform::CreateTranslation(
+                    landing.m_position + AZ::Vector3::CreateAxisZ(m_probeHeight + landing.m_radius));
+                sweepRequests.push_back(AZStd::make_shared<AzPhysics::ShapeCastRequest>(
+                    AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+                        landing.m_radius,
+                        sweepPose,
+                        AZ::Vector3::CreateAxisZ(-1.f),
+                        2.f * m_probeHeight,
+                        AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
+                        AzPhysics::CollisionGroup::All,
+                        castFilter)));
+                sweepLandings.push_back(i);
+            }
+
+            // Rest the feet on the floor that was found, otherwise the requested position is kept and the character falls from there
+            AzPhysics::SceneQueryHitsList sweepHits = sceneInterface->QuerySceneBatch(sceneHandle, sweepRequests);
+            for(size_t r = 0; r < sweepLandings.size() && r < sweepHits.size(); ++r)
+            {
+                if(!sweepHits[r])
+                    continue;
+
+                Landing& landing = landings[sweepLandings[r]];
+                const float floorDistance = sweepHits[r].m_hits.front().m_distance;
+                landing.m_position.SetZ(landing.m_position.GetZ() + m_probeHeight - floorDistance + m_skinWidth);
+            }
+
+            // Verify that every capsule is clear at its landing position
+            AzPhysics::SceneQueryRequests overlapRequests;
+            for(const size_t i : sweepLandings)
+            {
+                const Landing& landing = landings[i];
+                const AZ::Transform capsulePose = AZ::Transform::CreateTranslation(
+                    landing.m_position + AZ::Vector3::CreateAxisZ(0.5f * landing.m_height));
+                overlapRequests.push_back(AZStd::make_shared<AzPhysics::OverlapRequest>(
+                    AzPhysics::OverlapRequestHelpers::CreateCapsuleOverlapRequest(landing.m_height, landing.m_radius, capsulePose, overlapFilter)));
+            }
+
+            AzPhysics::SceneQueryHitsList overlapHits = sceneInterface->QuerySceneBatch(sceneHandle, overlapRequests);
+            for(size_t r = 0; r < sweepLandings.size() && r < overlapHits.size(); ++r)
+                if(overlapHits[r])
+                    landings[sweepLandings[r]].m_valid = false;
+        }
+
+        // Landings earlier in the batch take precedence over later ones that would overlap them
+        AZStd::vector<const Landing*> acceptedLandings;
+        acceptedLandings.reserve(count);
+        for(const Landing& landing : landings)
+        {
+            if(!landing.m_valid)
+                continue;
+
+            bool blocked = false;
+            for(const Landing* accepted : acceptedLandings)
+                if(accepted->m_sceneHandle == landing.m_sceneHandle && LandingsOverlap(landing, *accepted))
+                {
+                    blocked = true;
+                    break;
+                }
+            if(blocked)
+                continue;
+
+            acceptedLandings.push_back(&landing);
+        }
+
+        movedEntityIds.reserve(acceptedLandings.size());
+        for(const Landing* landing : acceptedLandings)
+        {
+            Physics::CharacterRequestBus::Event(landing->m_entityId,
+                &Physics::CharacterRequestBus::Events::SetBasePosition, landing->m_position);
+            FirstPersonControllerComponentRequestBus::Event(landing->m_entityId,
+                &FirstPersonControllerComponentRequestBus::Events::ResetVelocity);
+            movedEntityIds.push_back(landing->m_entityId);
+        }
+
+        return movedEntityIds;
+    }
+
+    bool CharacterTeleporter::LandingsOverlap(const Landing& a, const Landing& b)
+    {
+        const float radii = a.m_radius + b.m_radius;
+        const AZ::Vector3 offset = b.m_position - a.m_position;
+        if(offset.GetX()*offset.GetX() + offset.GetY()*offset.GetY() >= radii*radii)
+            return false;
+
+        return offset.GetZ() < a.m_height && -offset.GetZ() < b.m_height;
+    }
+
+    float CharacterTeleporter::GetProbeHeight() const
+    {
+        return m_probeHeight;
+    }
+
+    void CharacterTeleporter::SetProbeHeight(const float& probeHeight)
+    {
+        m_probeHeight = AZ::GetMax(probeHeight, 0.f);
+    }
+
+    float CharacterTeleporter::GetSkinWidth() const
+    {
+        return m_skinWidth;
+    }
+
+    void CharacterTeleporter::SetSkinWidth(const float& skinWidth)
+    {
+        m_skinWidth = AZ::GetMax(skinWidth, 0.f);
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,47 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+
+namespace FirstPersonController
+{
+    // Validates landing positions for character controllers and moves them there. The floor below each requested
+    // position is found with one batched sphere sweep per physics scene, the resulting capsules are checked with one
+    // batched overlap query per scene, and landing spots that would overlap each other within the same batch are
+    // rejected in request order.
+    class CharacterTeleporter
+    {
+    public:
+        // Returns the characters that were moved
+        AZStd::vector<AZ::EntityId> TeleportMany(const AZStd::vector<AZ::EntityId>& entityIds, const AZStd::vector<AZ::Vector3>& positions);
+
+        float GetProbeHeight() const;
+        void SetProbeHeight(const float& probeHeight);
+        float GetSkinWidth() const;
+        void SetSkinWidth(const float& skinWidth);
+
+    private:
+        struct Landing
+        {
+            AZ::EntityId m_entityId;
+            AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            float m_height = 0.f;
+            float m_radius = 0.f;
+            bool m_valid = false;
+        };
+
+        // Whether the capsules of two landings would intersect, assuming both are upright
+        static bool LandingsOverlap(const Landing& a, const Landing& b);
+
+        float m_probeHeight = 1.f;
+        float m_skinWidth = 0.02f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,43 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/ControllerLod.h>
+
+namespace FirstPersonController
+{
+    LodTier ControllerLod::SelectTier(const float& distanceSq, const float& reducedDistance, const float& minimalDistance)
+    {
+        if(distanceSq >= minimalDistance*minimalDistance)
+            return LodTier::Minimal;
+        if(distanceSq >= reducedDistance*reducedDistance)
+            return LodTier::Reduced;
+        return LodTier::Full;
+    }
+
+    AZ::u32 ControllerLod::GetStepInterval(const LodTier& tier, const AZ::u32& reducedStepInterval, const AZ::u32& minimalStepInterval)
+    {
+        if(tier == LodTier::Reduced)
+            return reducedStepInterval;
+        if(tier == LodTier::Minimal)
+            return minimalStepInterval;
+        return 1;
+    }
+
+    bool ControllerLod::StepDue(AZ::u32& skippedSteps, float& accumulatedDeltaTime, float& stepDeltaTime, const AZ::u32& stepInterval)
+    {
+        accumulatedDeltaTime += stepDeltaTime;
+
+        if(skippedSteps + 1 < stepInterval)
+        {
+            ++skippedSteps;
+            return false;
+        }
+
+        // Step using all of the time that has elapsed since the last step
+        stepDeltaTime = accumulatedDeltaTime;
+        accumulatedDeltaTime = 0.f;
+        skippedSteps = 0;
+        return true;
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,25 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <FirstPersonController/LodTier.h>
+
+namespace FirstPersonController
+{
+    // Level of detail tier selection and step skipping of a controller
+    class ControllerLod
+    {
+    public:
+        // Tier for a controller at the squared distance from the active camera
+        static LodTier SelectTier(const float& distanceSq, const float& reducedDistance, const float& minimalDistance);
+
+        // Number of movement steps the tier spans, 1 steps every time
+        static AZ::u32 GetStepInterval(const LodTier& tier, const AZ::u32& reducedStepInterval, const AZ::u32& minimalStepInterval);
+
+        // Accumulates stepDeltaTime and returns whether a step is due after skippedSteps skipped ones,
+        // on a due step stepDeltaTime becomes all of the time accumulated since the last step
+        static bool StepDue(AZ::u32& skippedSteps, float& accumulatedDeltaTime, float& stepDeltaTime, const AZ::u32& stepInterval);
+    };
+} // namespace FirstPersonController
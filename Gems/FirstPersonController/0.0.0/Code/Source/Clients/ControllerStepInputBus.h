@@ -0,0 +1,26 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <Clients/InputOverrideStack.h>
+
+#include <AzCore/Component/ComponentBus.h>
+
+namespace FirstPersonController
+{
+    // Lets another component on the controller's entity take part in the input of each movement step. The controller
+    // calls it from within the step, after the gamepad input and the input overrides are applied and before any movement
+    // is computed, so it doesn't depend on the order in which the components are ticked or on which scheduler steps them.
+    // The values that are changed are only used for the step, the controller's input values are restored afterwards.
+    class ControllerStepInputNotifications : public AZ::ComponentBus
+    {
+    public:
+        // values are in the order of the InputOverrideChannel bits, timestepElseTick is true for the steps run
+        // on the physics timesteps in between the ticks
+        virtual void OnStepInput(InputChannelValues& values, const bool& timestepElseTick) = 0;
+    };
+
+    using ControllerStepInputNotificationBus = AZ::EBus<ControllerStepInputNotifications>;
+} // namespace FirstPersonController
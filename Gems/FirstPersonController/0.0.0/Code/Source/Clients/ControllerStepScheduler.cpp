@@ -0,0 +1,332 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/ControllerStepScheduler.h>
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+
+#include <AzFramework/Physics/PhysicsScene.h>
+
+namespace FirstPersonController
+{
+    ControllerStepScheduler::ControllerStepScheduler()
+    {
+        if(ControllerStepSchedulerInterface::Get() == nullptr)
+            ControllerStepSchedulerInterface::Register(this);
+    }
+
+    ControllerStepScheduler::~ControllerStepScheduler()
+    {
+        Clear();
+        if(ControllerStepSchedulerInterface::Get() == this)
+            ControllerStepSchedulerInterface::Unregister(this);
+    }
+
+    void ControllerStepScheduler::AddController(SteppedController* controller, const AzPhysics::SceneHandle& sceneHandle,
+        const bool& timestepElseTick)
+    {
+        // A notification handler may move a controller whose step hasn't ended yet, so the move waits for the end of the step
+        if(m_stepping > 0)
+        {
+            for(PendingAdd& pendingAdd : m_pendingAdds)
+                if(pendingAdd.m_controller == controller)
+                {
+                    pendingAdd.m_sceneHandle = sceneHandle;
+                    pendingAdd.m_timestepElseTick = timestepElseTick;
+                    return;
+                }
+            m_pendingAdds.push_back({ controller, sceneHandle, timestepElseTick });
+            return;
+        }
+
+        InsertController(controller, sceneHandle, timestepElseTick);
+        RemoveEmptySceneGroups();
+    }
+
+    void ControllerStepScheduler::InsertController(SteppedController* controller, const AzPhysics::SceneHandle& sceneHandle,
+        const bool& timestepElseTick)
+    {
+        DetachController(controller);
+
+        SceneGroup& sceneGroup = GetOrCreateSceneGroup(sceneHandle);
+        if(timestepElseTick)
+            sceneGroup.m_timestepControllers.push_back(controller);
+        else
+            sceneGroup.m_tickControllers.push_back(controller);
+
+        // Timestep controllers are stepped at the start of their scene's simulation
+        if(timestepElseTick && !sceneGroup.m_sceneSimulationStartHandler.IsConnected() && sceneHandle != AzPhysics::InvalidSceneHandle)
+        {
+            SceneGroup* sceneGroupPtr = &sceneGroup;
+            sceneGroup.m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+                [this, sceneGroupPtr]([[maybe_unused]] AzPhysics::SceneHandle simulatedSceneHandle, float fixedDeltaTime)
+                {
+                    StepTimestepControllers(*sceneGroupPtr, fixedDeltaTime);
+                }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
+
+            if(auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+                sceneInterface->RegisterSceneSimulationStartHandler(sceneHandle, sceneGroup.m_sceneSimulationStartHandler);
+        }
+    }
+
+    void ControllerStepScheduler::RemoveController(SteppedController* controller)
+    {
+        DetachController(controller);
+        m_pendingAdds.erase(AZStd::remove_if(m_pendingAdds.begin(), m_pendingAdds.end(),
+            [controller](const PendingAdd& pendingAdd)
+            {
+                return pendingAdd.m_controller == controller;
+            }), m_pendingAdds.end());
+
+        // A controller removed during a step, e.g. deactivated by a notification handler, is skipped for the rest of the step
+        for(auto& sceneGroup : m_sceneGroups)
+        {
+            for(SteppedController*& dueController : sceneGroup->m_dueControllers)
+                if(dueController == controller)
+                    dueController = nullptr;
+            for(SteppedController*& begunController : sceneGroup->m_begunControllers)
+                if(begunController == controller)
+                    begunController = nullptr;
+        }
+
+        if(m_stepping == 0)
+            RemoveEmptySceneGroups();
+    }
+
+    void ControllerStepScheduler::DetachController(SteppedController* controller)
+    {
+        for(auto& sceneGroup : m_sceneGroups)
+        {
+            AZStd::erase(sceneGroup->m_tickControllers, controller);
+            AZStd::erase(sceneGroup->m_timestepControllers, controller);
+        }
+    }
+
+    void ControllerStepScheduler::FinishStepping()
+    {
+        // Inserting only connects simulation start handlers, nothing is stepped that could add more controllers
+        for(const PendingAdd& pendingAdd : m_pendingAdds)
+            InsertController(pendingAdd.m_controller, pendingAdd.m_sceneHandle, pendingAdd.m_timestepElseTick);
+        m_pendingAdds.clear();
+
+        RemoveEmptySceneGroups();
+    }
+
+    void ControllerStepScheduler::Clear()
+    {
+        m_pendingAdds.clear();
+        for(auto& sceneGroup : m_sceneGroups)
+            sceneGroup->m_sceneSimulationStartHandler.Disconnect();
+        m_sceneGroups.clear();
+    }
+
+    bool ControllerStepScheduler::GetParallelSceneStepping() const
+    {
+        return m_parallelSceneStepping;
+    }
+
+    void ControllerStepScheduler::SetParallelSceneStepping(const bool& parallelSceneStepping)
+    {
+        m_parallelSceneStepping = parallelSceneStepping;
+    }
+
+    AZ::u32 ControllerStepScheduler::GetControllersPerJob() const
+    {
+        return m_controllersPerJob;
+    }
+
+    void ControllerStepScheduler::SetControllersPerJob(const AZ::u32& controllersPerJob)
+    {
+        m_controllersPerJob = controllersPerJob;
+    }
+
+    AZ::u32 ControllerStepScheduler::GetLastQueryPhaseMicroseconds() const
+    {
+        return m_lastQueryPhaseMicroseconds;
+    }
+
+    AZ::u32 ControllerStepScheduler::GetLastSerialPhaseMicroseconds() const
+    {
+        return m_lastSerialPhaseMicroseconds;
+    }
+
+    AZ::u32 ControllerStepScheduler::GetSceneCount() const
+    {
+        return static_cast<AZ::u32>(m_sceneGroups.size());
+    }
+
+    AZ::u32 ControllerStepScheduler::GetControllerCount() const
+    {
+        size_t count = 0;
+        for(const auto& sceneGroup : m_sceneGroups)
+            count += sceneGroup->m_tickControllers.size() + sceneGroup->m_timestepControllers.size();
+        return static_cast<AZ::u32>(count);
+    }
+
+    void ControllerStepScheduler::Tick(const float& deltaTime)
+    {
+        ++m_stepping;
+        const auto beginTime = AZStd::chrono::steady_clock::now();
+
+        // Every controller runs its per tick work, only the ones that add their velocity per tick take a movement step.
+        // Groups are indexed rather than iterated since notification handlers can add controllers during a step.
+        const size_t sceneGroupCount = m_sceneGroups.size();
+        AZStd::vector<SceneGroup*> steppedGroups;
+        steppedGroups.reserve(sceneGroupCount);
+        for(size_t i = 0; i < sceneGroupCount; ++i)
+        {
+            SceneGroup& sceneGroup = *m_sceneGroups[i];
+            sceneGroup.m_dueControllers.clear();
+            sceneGroup.m_dueDeltaTimes.clear();
+            sceneGroup.m_begunControllers.clear();
+            BeginSteps(sceneGroup, sceneGroup.m_tickControllers, deltaTime, false);
+            BeginSteps(sceneGroup, sceneGroup.m_timestepControllers, deltaTime, false);
+            steppedGroups.push_back(&sceneGroup);
+        }
+
+        const auto queryTime = AZStd::chrono::steady_clock::now();
+        PlanSceneQueries(steppedGroups);
+        const auto finishTime = AZStd::chrono::steady_clock::now();
+
+        for(SceneGroup* sceneGroup : steppedGroups)
+            FinishSteps(*sceneGroup);
+        for(SceneGroup* sceneGroup : steppedGroups)
+            EndSteps(*sceneGroup);
+
+        const auto endTime = AZStd::chrono::steady_clock::now();
+        m_lastQueryPhaseMicroseconds = static_cast<AZ::u32>(
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(finishTime - queryTime).count());
+        m_lastSerialPhaseMicroseconds = static_cast<AZ::u32>(
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>((queryTime - beginTime) + (endTime - finishTime)).count());
+
+        if(--m_stepping == 0)
+            FinishStepping();
+    }
+
+    ControllerStepScheduler::SceneGroup& ControllerStepScheduler::GetOrCreateSceneGroup(const AzPhysics::SceneHandle& sceneHandle)
+    {
+        for(auto& sceneGroup : m_sceneGroups)
+            if(sceneGroup->m_sceneHandle == sceneHandle)
+                return *sceneGroup;
+
+        m_sceneGroups.push_back(AZStd::make_unique<SceneGroup>());
+        m_sceneGroups.back()->m_sceneHandle = sceneHandle;
+        return *m_sceneGroups.back();
+    }
+
+    void ControllerStepScheduler::StepTimestepControllers(SceneGroup& sceneGroup, const float& fixedDeltaTime)
+    {
+        ++m_stepping;
+
+        sceneGroup.m_dueControllers.clear();
+        sceneGroup.m_dueDeltaTimes.clear();
+        sceneGroup.m_begunControllers.clear();
+        BeginSteps(sceneGroup, sceneGroup.m_timestepControllers, fixedDeltaTime, true);
+        PlanSceneQueries(AZStd::vector<SceneGroup*>{ &sceneGroup });
+        FinishSteps(sceneGroup);
+        EndSteps(sceneGroup);
+
+        if(--m_stepping == 0)
+            FinishStepping();
+    }
+
+    void ControllerStepScheduler::RemoveEmptySceneGroups()
+    {
+        // Scenes without controllers are dropped along with their simulation start handler
+        for(size_t i = 0; i < m_sceneGroups.size();)
+        {
+            SceneGroup& sceneGroup = *m_sceneGroups[i];
+            if(sceneGroup.m_tickControllers.empty() && sceneGroup.m_timestepControllers.empty())
+            {
+                sceneGroup.m_sceneSimulationStartHandler.Disconnect();
+                m_sceneGroups.erase(m_sceneGroups.begin() + i);
+            }
+            else
+                ++i;
+        }
+    }
+
+    void ControllerStepScheduler::BeginSteps(SceneGroup& sceneGroup, const AZStd::vector<SteppedController*>& controllers,
+        const float& deltaTime, const bool& timestepElseTick)
+    {
+        for(size_t i = 0; i < controllers.size(); ++i)
+        {
+            SteppedController* controller = controllers[i];
+            float stepDeltaTime = timestepElseTick ? deltaTime * controller->GetPhysicsTimestepScaleFactor() : deltaTime;
+            sceneGroup.m_begunControllers.push_back(controller);
+            if(controller->BeginStep(stepDeltaTime, timestepElseTick))
+            {
+                sceneGroup.m_dueControllers.push_back(controller);
+                sceneGroup.m_dueDeltaTimes.push_back(stepDeltaTime);
+            }
+        }
+    }
+
+    void ControllerStepScheduler::PlanSceneQueries(const AZStd::vector<SceneGroup*>& sceneGroups)
+    {
+        // Split the due controllers into jobs, one per scene or one per m_controllersPerJob controllers
+        struct QueryJob
+        {
+            SceneGroup* m_sceneGroup;
+            size_t m_first;
+            size_t m_last;
+        };
+        AZStd::vector<QueryJob> queryJobs;
+        for(SceneGroup* sceneGroup : sceneGroups)
+        {
+            const size_t dueCount = sceneGroup->m_dueControllers.size();
+            const size_t jobSize = (m_controllersPerJob > 0) ? m_controllersPerJob : AZ::GetMax(dueCount, size_t(1));
+            for(size_t first = 0; first < dueCount; first += jobSize)
+                queryJobs.push_back({ sceneGroup, first, AZ::GetMin(first + jobSize, dueCount) });
+        }
+
+        if(!m_parallelSceneStepping || queryJobs.size() < 2)
+        {
+            for(const QueryJob& queryJob : queryJobs)
+                PlanSceneQueries(*queryJob.m_sceneGroup, queryJob.m_first, queryJob.m_last);
+            return;
+        }
+
+        // The queries only read the physics scene and write to their own controller, so they can run on any worker
+        AZ::JobCompletion completion;
+        for(const QueryJob& queryJob : queryJobs)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([this, queryJob]()
+                {
+                    PlanSceneQueries(*queryJob.m_sceneGroup, queryJob.m_first, queryJob.m_last);
+                }, true);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+    }
+
+    void ControllerStepScheduler::PlanSceneQueries(SceneGroup& sceneGroup, const size_t& first, const size_t& last)
+    {
+        for(size_t i = first; i < last; ++i)
+            if(sceneGroup.m_dueControllers[i] != nullptr)
+                sceneGroup.m_dueControllers[i]->PlanSceneQueries();
+    }
+
+    void ControllerStepScheduler::FinishSteps(SceneGroup& sceneGroup)
+    {
+        for(size_t i = 0; i < sceneGroup.m_dueControllers.size(); ++i)
+            if(sceneGroup.m_dueControllers[i] != nullptr)
+                sceneGroup.m_dueControllers[i]->FinishStep(sceneGroup.m_dueDeltaTimes[i]);
+        sceneGroup.m_dueControllers.clear();
+        sceneGroup.m_dueDeltaTimes.clear();
+    }
+
+    void ControllerStepScheduler::EndSteps(SceneGroup& sceneGroup)
+    {
+        for(size_t i = 0; i < sceneGroup.m_begunControllers.size(); ++i)
+            if(sceneGroup.m_begunControllers[i] != nullptr)
+                sceneGroup.m_begunControllers[i]->EndStep();
+        sceneGroup.m_begunControllers.clear();
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,120 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+
+namespace FirstPersonController
+{
+    // The stages of a movement step run by the scheduler, implemented by FirstPersonControllerComponent.
+    // BeginStep returns whether a movement step is due and sets its delta time, PlanSceneQueries may run on a
+    // job-system worker so it only reads the physics scene and writes to the controller's own state.
+    class SteppedController
+    {
+    public:
+        virtual ~SteppedController() = default;
+
+        virtual float GetPhysicsTimestepScaleFactor() const = 0;
+        virtual bool BeginStep(float& stepDeltaTime, const bool& timestepElseTick) = 0;
+        virtual void PlanSceneQueries() = 0;
+        virtual void FinishStep(const float& stepDeltaTime) = 0;
+        virtual void EndStep() = 0;
+    };
+
+    // Steps every First Person Controller grouped by the physics scene it queries. Controllers that add their velocity
+    // per tick are stepped from the system tick, and controllers that add their velocity per physics timestep are stepped
+    // from one simulation start handler per scene.
+    // Each step runs in two phases: the scene queries of every due controller, which only read the scene and can run on
+    // job-system workers, followed by the rest of every step on the calling thread since it writes through EBuses.
+    // Begin, finish and end of each step, including input, velocity submission and notifications, are always serial.
+    // The notifications raised by the steps are only dispatched once every controller in the scene has been stepped.
+    class ControllerStepScheduler
+    {
+    public:
+        AZ_RTTI(ControllerStepScheduler, "{c4e1a7d2-5b39-4f80-9e26-1d8b73f0a5c9}");
+
+        ControllerStepScheduler();
+        virtual ~ControllerStepScheduler();
+
+        // Adds the controller or moves it to another scene or stepping mode if it is already scheduled.
+        // During a step the move is held back until the step is done, so the controller's step still ends.
+        void AddController(SteppedController* controller, const AzPhysics::SceneHandle& sceneHandle, const bool& timestepElseTick);
+        void RemoveController(SteppedController* controller);
+        void Clear();
+
+        bool GetParallelSceneStepping() const;
+        void SetParallelSceneStepping(const bool& parallelSceneStepping);
+        // Number of controllers per query job when stepping in parallel, 0 runs one job per scene
+        AZ::u32 GetControllersPerJob() const;
+        void SetControllersPerJob(const AZ::u32& controllersPerJob);
+        AZ::u32 GetSceneCount() const;
+        AZ::u32 GetControllerCount() const;
+
+        // Wall time of the query phase and of the serial phases during the last tick, in microseconds
+        AZ::u32 GetLastQueryPhaseMicroseconds() const;
+        AZ::u32 GetLastSerialPhaseMicroseconds() const;
+
+        // Runs the per tick work of every controller and steps the controllers that add their velocity per tick
+        void Tick(const float& deltaTime);
+
+    private:
+        struct SceneGroup
+        {
+            AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+            AZStd::vector<SteppedController*> m_tickControllers;
+            AZStd::vector<SteppedController*> m_timestepControllers;
+            AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimulationStartHandler;
+
+            // Controllers due for a movement step and their step delta times, filled in by BeginSteps
+            AZStd::vector<SteppedController*> m_dueControllers;
+            AZStd::vector<float> m_dueDeltaTimes;
+            // Every controller that began a step, their steps are ended once all of them are done
+            AZStd::vector<SteppedController*> m_begunControllers;
+        };
+
+        SceneGroup& GetOrCreateSceneGroup(const AzPhysics::SceneHandle& sceneHandle);
+        void InsertController(SteppedController* controller, const AzPhysics::SceneHandle& sceneHandle, const bool& timestepElseTick);
+        void DetachController(SteppedController* controller);
+        // Runs once the outermost step is done
+        void FinishStepping();
+        void StepTimestepControllers(SceneGroup& sceneGroup, const float& fixedDeltaTime);
+        void RemoveEmptySceneGroups();
+
+        // Runs the three stages of a movement step: the per controller work ahead of the step,
+        // the scene queries and the rest of the step
+        void BeginSteps(SceneGroup& sceneGroup, const AZStd::vector<SteppedController*>& controllers,
+            const float& deltaTime, const bool& timestepElseTick);
+        void PlanSceneQueries(const AZStd::vector<SceneGroup*>& sceneGroups);
+        void PlanSceneQueries(SceneGroup& sceneGroup, const size_t& first, const size_t& last);
+        void FinishSteps(SceneGroup& sceneGroup);
+        void EndSteps(SceneGroup& sceneGroup);
+
+        // Controllers added or moved during a step
+        struct PendingAdd
+        {
+            SteppedController* m_controller = nullptr;
+            AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+            bool m_timestepElseTick = false;
+        };
+        AZStd::vector<PendingAdd> m_pendingAdds;
+
+        // Groups are heap allocated so that the simulation start handlers can keep referring to them
+        AZStd::vector<AZStd::unique_ptr<SceneGroup>> m_sceneGroups;
+        bool m_parallelSceneStepping = false;
+        AZ::u32 m_controllersPerJob = 0;
+        AZ::u32 m_lastQueryPhaseMicroseconds = 0;
+        AZ::u32 m_lastSerialPhaseMicroseconds = 0;
+        // Nonzero while controllers are being stepped, empty groups are only removed and pending adds only applied
+        // once the step is done
+        AZ::u32 m_stepping = 0;
+    };
+
+    using ControllerStepSchedulerInterface = AZ::Interface<ControllerStepScheduler>;
+} // namespace FirstPersonController
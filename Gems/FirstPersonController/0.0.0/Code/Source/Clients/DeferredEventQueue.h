@@ -0,0 +1,71 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+
+namespace FirstPersonController
+{
+    // Events raised while deferring are queued and dispatched together by Flush(), in the order they were raised.
+    // Outside of a deferral they are dispatched right away.
+    template<typename Event>
+    class DeferredEventQueue
+    {
+    public:
+        void Defer()
+        {
+            m_deferring = true;
+        }
+
+        bool IsDeferring() const
+        {
+            return m_deferring;
+        }
+
+        template<typename Dispatch>
+        void Push(const Event& event, const Dispatch& dispatch)
+        {
+            if(m_deferring)
+                m_events.push_back(event);
+            else
+                dispatch(event);
+        }
+
+        // Stops deferring and dispatches the queued events, the events raised by their handlers are dispatched right away
+        template<typename Dispatch>
+        void Flush(const Dispatch& dispatch)
+        {
+            m_deferring = false;
+            if(m_events.empty())
+                return;
+
+            // Handlers may push or flush again, so the queue is swapped out before dispatching
+            AZStd::vector<Event> events;
+            events.swap(m_events);
+            for(const Event& event : events)
+                dispatch(event);
+
+            // Keep the capacity for the next deferral
+            events.clear();
+            if(m_events.empty())
+                m_events.swap(events);
+        }
+
+        void Clear()
+        {
+            m_events.clear();
+            m_deferring = false;
+        }
+
+        AZ::u32 GetCount() const
+        {
+            return static_cast<AZ::u32>(m_events.size());
+        }
+
+    private:
+        AZStd::vector<Event> m_events;
+        bool m_deferring = false;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,384 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/FirstPersonCarryComponent.h>
+#include <Clients/PhysicsSceneLookup.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+#include <FirstPersonController/FirstPersonInteractionComponentBus.h>
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
+
+namespace FirstPersonController
+{
+    using namespace StartingPointInput;
+
+    void FirstPersonCarryComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<FirstPersonCarryComponent, AZ::Component>()
+              ->Field("Grab Key", &FirstPersonCarryComponent::m_strGrab)
+              ->Field("Throw Key", &FirstPersonCarryComponent::m_strThrow)
+              ->Field("Inspect Key", &FirstPersonCarryComponent::m_strInspect)
+              ->Field("Hold Distance (m)", &FirstPersonCarryComponent::m_holdDistance)
+              ->Field("Break Distance (m)", &FirstPersonCarryComponent::m_breakDistance)
+              ->Field("Throw Speed (m/s)", &FirstPersonCarryComponent::m_throwSpeed)
+              ->Field("Inspect Sensitivity", &FirstPersonCarryComponent::m_inspectSensitivity)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Class<FirstPersonCarryComponent>("First Person Carry",
+                    "Grabs, carries, inspects and throws the focused Grabbable entity using physics velocities")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller")
+                    ->DataElement(nullptr,
+                        &FirstPersonCarryComponent::m_strGrab,
+                        "Grab Key", "Key for grabbing the focused entity and releasing the held entity. Must match an Event Name in the .inputbindings file, "
+                        "and should differ from the First Person Interaction component's Interact Key so one press doesn't both interact and grab.")
+                    ->DataElement(nullptr,
+                        &FirstPersonCarryComponent::m_strThrow,
+                        "Throw Key", "Key for throwing the held entity. Must match an Event Name in the .inputbindings file.")
+                    ->DataElement(nullptr,
+                        &FirstPersonCarryComponent::m_strInspect,
+                        "Inspect Key", "While this key is held the look input rotates the held entity instead of the camera.")
+                    ->DataElement(nullptr,
+                        &FirstPersonCarryComponent::m_holdDistance,
+                        "Hold Distance (m)", "Distance in front of the camera at which the held entity is carried.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonCarryComponent::m_breakDistance,
+                        "Break Distance (m)", "The held entity is released when it is blocked this far away from where it is being carried.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonCarryComponent::m_throwSpeed,
+                        "Throw Speed (m/s)", "Speed of the held entity along the camera's forward direction when it is thrown.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonCarryComponent::m_inspectSensitivity,
+                        "Inspect Sensitivity", "Rotation applied to the held entity per unit of look input while inspecting.");
+            }
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->EBus<FirstPersonCarryComponentRequestBus>("FirstPersonCarryComponentRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Get Held EntityId", &FirstPersonCarryComponentRequests::GetHeldEntityId)
+                ->Event("Grab", &FirstPersonCarryComponentRequests::Grab)
+                ->Event("Release", &FirstPersonCarryComponentRequests::Release)
+                ->Event("Throw", &FirstPersonCarryComponentRequests::Throw)
+                ->Event("Get Is Inspecting", &FirstPersonCarryComponentRequests::GetIsInspecting)
+                ->Event("Get Hold Distance", &FirstPersonCarryComponentRequests::GetHoldDistance)
+                ->Event("Set Hold Distance", &FirstPersonCarryComponentRequests::SetHoldDistance)
+                ->Event("Get Break Distance", &FirstPersonCarryComponentRequests::GetBreakDistance)
+                ->Event("Set Break Distance", &FirstPersonCarryComponentRequests::SetBreakDistance)
+                ->Event("Get Throw Speed", &FirstPersonCarryComponentRequests::GetThrowSpeed)
+                ->Event("Set Throw Speed", &FirstPersonCarryComponentRequests::SetThrowSpeed)
+                ->Event("Get Inspect Sensitivity", &FirstPersonCarryComponentRequests::GetInspectSensitivity)
+                ->Event("Set Inspect Sensitivity", &FirstPersonCarryComponentRequests::SetInspectSensitivity);
+
+            bc->Class<FirstPersonCarryComponent>()->RequestBus("FirstPersonCarryComponentRequestBus");
+        }
+    }
+
+    void FirstPersonCarryComponent::Activate()
+    {
+        // Objects are carried in the physics scene of the character
+        m_attachedSceneHandle = GetEntityPhysicsScene(GetEntityId());
+        if(m_attachedSceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            AZ_Error("First Person Carry Component", false, "Failed to retrieve the physics scene.");
+            return;
+        }
+
+        m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                OnSceneSimulationStart(fixedDeltaTime);
+            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
+
+        if(auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            sceneInterface->RegisterSceneSimulationStartHandler(m_attachedSceneHandle, m_sceneSimulationStartHandler);
+
+        Camera::CameraSystemRequestBus::BroadcastResult(m_activeCameraEntityId,
+            &Camera::CameraSystemRequestBus::Events::GetActiveCamera);
+        Camera::CameraNotificationBus::Handler::BusConnect();
+
+        ConnectInputEvents();
+
+        AZ::TickBus::Handler::BusConnect();
+        FirstPersonCarryComponentRequestBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void FirstPersonCarryComponent::Deactivate()
+    {
+        Release();
+
+        AZ::TickBus::Handler::BusDisconnect();
+        Camera::CameraNotificationBus::Handler::BusDisconnect();
+        InputEventNotificationBus::MultiHandler::BusDisconnect();
+        FirstPersonCarryComponentRequestBus::Handler::BusDisconnect();
+
+        m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
+        m_sceneSimulationStartHandler.Disconnect();
+    }
+
+    void FirstPersonCarryComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("FirstPersonControllerService"));
+        required.push_back(AZ_CRC_CE("FirstPersonInteractionService"));
+    }
+
+    void FirstPersonCarryComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("FirstPersonCarryService"));
+    }
+
+    void FirstPersonCarryComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("FirstPersonCarryService"));
+    }
+
+    void FirstPersonCarryComponent::ConnectInputEvents()
+    {
+        // Disconnect prior to connecting since this may be a reassignment
+        InputEventNotificationBus::MultiHandler::BusDisconnect();
+
+        m_grabEventId = InputEventNotificationId(m_strGrab.c_str());
+        m_throwEventId = InputEventNotificationId(m_strThrow.c_str());
+        m_inspectEventId = InputEventNotificationId(m_strInspect.c_str());
+
+        InputEventNotificationBus::MultiHandler::BusConnect(m_grabEventId);
+        InputEventNotificationBus::MultiHandler::BusConnect(m_throwEventId);
+        InputEventNotificationBus::MultiHandler::BusConnect(m_inspectEventId);
+    }
+
+    void FirstPersonCarryComponent::OnActiveViewChanged(const AZ::EntityId& activeEntityId)
+    {
+        m_activeCameraEntityId = activeEntityId;
+    }
+
+    void FirstPersonCarryComponent::OnPressed([[maybe_unused]] float value)
+    {
+        const InputEventNotificationId* inputId = InputEventNotificationBus::GetCurrentBusId();
+        if(inputId == nullptr)
+            return;
+
+        if(*inputId == m_grabEventId)
+        {
+            if(m_heldEntityId.IsValid())
+                Release();
+            else
+            {
+                AZ::EntityId focusedEntityId;
+                FirstPersonInteractionComponentRequestBus::EventResult(focusedEntityId, GetEntityId(),
+                    &FirstPersonInteractionComponentRequestBus::Events::GetFocusedEntityId);
+                Grab(focusedEntityId);
+            }
+        }
+        else if(*inputId == m_throwEventId)
+            Throw();
+        else if(*inputId == m_inspectEventId)
+            SetInspecting(true);
+    }
+
+    void FirstPersonCarryComponent::OnReleased([[maybe_unused]] float value)
+    {
+        const InputEventNotificationId* inputId = InputEventNotificationBus::GetCurrentBusId();
+        if(inputId != nullptr && *inputId == m_inspectEventId)
+            SetInspecting(false);
+    }
+
+    void FirstPersonCarryComponent::OnTick([[maybe_unused]] float deltaTime, AZ::ScriptTimePoint)
+    {
+        if(!m_inspecting)
+            return;
+
+        // The look input is consumed once per frame, the same rate at which the controller consumes it
+        float yawValue = 0.f;
+        float pitchValue = 0.f;
+        AZ::Vector2 gamepadLookDelta = AZ::Vector2::CreateZero();
+        FirstPersonControllerComponentRequestBus::EventResult(yawValue, GetEntityId(),
+            &FirstPersonControllerComponentRequestBus::Events::GetYawInputValue);
+        FirstPersonControllerComponentRequestBus::EventResult(pitchValue, GetEntityId(),
+            &FirstPersonControllerComponentRequestBus::Events::GetPitchInputValue);
+        FirstPersonControllerComponentRequestBus::EventResult(gamepadLookDelta, GetEntityId(),
+            &FirstPersonControllerComponentRequestBus::Events::GetGamepadLookDelta);
+
+        // The gamepad delta is already an angle scaled by the controller's gamepad look speeds, so it is applied
+        // with the same signs the controller uses to turn the camera
+        m_holdLocalRotation = (AZ::Quaternion::CreateRotationZ(-yawValue * m_inspectSensitivity - gamepadLookDelta.GetX())
+            * AZ::Quaternion::CreateRotationX(-pitchValue * m_inspectSensitivity + gamepadLookDelta.GetY())
+            * m_holdLocalRotation).GetNormalized();
+    }
+
+    void FirstPersonCarryComponent::OnSceneSimulationStart(float physicsTimestep)
+    {
+        if(!m_heldEntityId.IsValid())
+            return;
+
+        // The held entity may have been deactivated or destroyed
+        if(GrabbableComponentRequestBus::FindFirstHandler(m_heldEntityId) == nullptr)
+        {
+            SetInspecting(false);
+            m_heldEntityId = AZ::EntityId();
+            return;
+        }
+
+        AZ::Transform cameraTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(cameraTM, m_activeCameraEntityId, &AZ::TransformBus::Events::GetWorldTM);
+        AZ::Transform heldTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(heldTM, m_heldEntityId, &AZ::TransformBus::Events::GetWorldTM);
+
+        const AZ::Vector3 targetPosition = cameraTM.GetTranslation() + cameraTM.GetBasisY().GetNormalized() * m_holdDistance;
+        const AZ::Vector3 offset = targetPosition - heldTM.GetTranslation();
+
+        // Release the entity when it's blocked too far from where it's being carried
+        if(offset.GetLength() > m_breakDistance)
+        {
+            Drop(false);
+            return;
+        }
+
+        // Close at most the whole remaining distance and angle within one physics step
+        const float rate = physicsTimestep > 0.f ? AZ::GetMin(m_heldFollowRate, 1.f / physicsTimestep) : m_heldFollowRate;
+
+        AZ::Vector3 linearVelocity = offset * rate;
+        if(linearVelocity.GetLength() > m_heldMaxFollowSpeed)
+            linearVelocity = linearVelocity.GetNormalized() * m_heldMaxFollowSpeed;
+
+        AZ::Quaternion rotationError = (cameraTM.GetRotation() * m_holdLocalRotation) * heldTM.GetRotation().GetInverseFull();
+        if(rotationError.GetW() < 0.f)
+            rotationError = -rotationError;
+        AZ::Vector3 axis = AZ::Vector3::CreateAxisZ();
+        float angle = 0.f;
+        rotationError.ConvertToAxisAngle(axis, angle);
+
+        Physics::RigidBodyRequestBus::Event(m_heldEntityId, &Physics::RigidBodyRequests::SetLinearVelocity, linearVelocity);
+        Physics::RigidBodyRequestBus::Event(m_heldEntityId, &Physics::RigidBodyRequests::SetAngularVelocity, axis * angle * rate);
+    }
+
+    void FirstPersonCarryComponent::SetInspecting(const bool& inspecting)
+    {
+        const bool newInspecting = inspecting && m_heldEntityId.IsValid() && m_heldInspectable;
+        if(newInspecting == m_inspecting)
+            return;
+
+        m_inspecting = newInspecting;
+        FirstPersonControllerComponentRequestBus::Event(GetEntityId(),
+            &FirstPersonControllerComponentRequestBus::Events::SetLookInputRedirected, m_inspecting);
+    }
+
+    void FirstPersonCarryComponent::Drop(const bool& thrown)
+    {
+        if(!m_heldEntityId.IsValid())
+            return;
+
+        SetInspecting(false);
+
+        const AZ::EntityId heldEntityId = m_heldEntityId;
+        m_heldEntityId = AZ::EntityId();
+
+        Physics::RigidBodyRequestBus::Event(heldEntityId, &Physics::RigidBodyRequests::SetGravityEnabled, m_heldGravityEnabled);
+
+        AZ::Transform cameraTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(cameraTM, m_activeCameraEntityId, &AZ::TransformBus::Events::GetWorldTM);
+        if(thrown)
+            Physics::RigidBodyRequestBus::Event(heldEntityId, &Physics::RigidBodyRequests::SetLinearVelocity,
+                cameraTM.GetBasisY().GetNormalized() * m_throwSpeed);
+
+        GrabbableComponentRequestBus::Event(heldEntityId, &GrabbableComponentRequestBus::Events::OnDropped, thrown);
+    }
+
+    // Request Bus getter and setter methods for use in scripts
+    AZ::EntityId FirstPersonCarryComponent::GetHeldEntityId() const
+    {
+        return m_heldEntityId;
+    }
+    bool FirstPersonCarryComponent::Grab(const AZ::EntityId& entityId)
+    {
+        if(!entityId.IsValid() || m_heldEntityId.IsValid())
+            return false;
+
+        bool alreadyHeld = true;
+        GrabbableComponentRequestBus::EventResult(alreadyHeld, entityId, &GrabbableComponentRequestBus::Events::GetIsHeld);
+        if(alreadyHeld)
+            return false;
+
+        m_heldEntityId = entityId;
+        GrabbableComponentRequestBus::EventResult(m_heldFollowRate, entityId, &GrabbableComponentRequestBus::Events::GetFollowRate);
+        GrabbableComponentRequestBus::EventResult(m_heldMaxFollowSpeed, entityId, &GrabbableComponentRequestBus::Events::GetMaxFollowSpeed);
+        GrabbableComponentRequestBus::EventResult(m_heldInspectable, entityId, &GrabbableComponentRequestBus::Events::GetInspectable);
+
+        // Gravity is disabled while held so that the follow velocity doesn't have to fight it
+        m_heldGravityEnabled = true;
+        Physics::RigidBodyRequestBus::EventResult(m_heldGravityEnabled, entityId, &Physics::RigidBodyRequests::IsGravityEnabled);
+        Physics::RigidBodyRequestBus::Event(entityId, &Physics::RigidBodyRequests::SetGravityEnabled, false);
+        Physics::RigidBodyRequestBus::Event(entityId, &Physics::RigidBodyRequests::ForceAwake);
+
+        // Keep the entity's current orientation relative to the camera
+        AZ::Transform cameraTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(cameraTM, m_activeCameraEntityId, &AZ::TransformBus::Events::GetWorldTM);
+        AZ::Transform heldTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(heldTM, entityId, &AZ::TransformBus::Events::GetWorldTM);
+        m_holdLocalRotation = (cameraTM.GetRotation().GetInverseFull() * heldTM.GetRotation()).GetNormalized();
+
+        GrabbableComponentRequestBus::Event(entityId, &GrabbableComponentRequestBus::Events::OnPickedUp, GetEntityId());
+        return true;
+    }
+    void FirstPersonCarryComponent::Release()
+    {
+        Drop(false);
+    }
+    void FirstPersonCarryComponent::Throw()
+    {
+        Drop(true);
+    }
+    bool FirstPersonCarryComponent::GetIsInspecting() const
+    {
+        return m_inspecting;
+    }
+    float FirstPersonCarryComponent::GetHoldDistance() const
+    {
+        return m_holdDistance;
+    }
+    void FirstPersonCarryComponent::SetHoldDistance(const float& new_holdDistance)
+    {
+        m_holdDistance = AZ::GetMax(new_holdDistance, 0.f);
+    }
+    float FirstPersonCarryComponent::GetBreakDistance() const
+    {
+        return m_breakDistance;
+    }
+    void FirstPersonCarryComponent::SetBreakDistance(const float& new_breakDistance)
+    {
+        m_breakDistance = AZ::GetMax(new_breakDistance, 0.f);
+    }
+    float FirstPersonCarryComponent::GetThrowSpeed() const
+    {
+        return m_throwSpeed;
+    }
+    void FirstPersonCarryComponent::SetThrowSpeed(const float& new_throwSpeed)
+    {
+        m_throwSpeed = AZ::GetMax(new_throwSpeed, 0.f);
+    }
+    float FirstPersonCarryComponent::GetInspectSensitivity() const
+    {
+        return m_inspectSensitivity;
+    }
+    void FirstPersonCarryComponent::SetInspectSensitivity(const float& new_inspectSensitivity)
+    {
+        m_inspectSensitivity = new_inspectSensitivity;
+    }
+} // namespace FirstPersonController
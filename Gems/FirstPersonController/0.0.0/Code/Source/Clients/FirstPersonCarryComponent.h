@@ -0,0 +1,99 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+#include <FirstPersonController/GrabbableComponentBus.h>
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Quaternion.h>
+
+#include <AzFramework/Components/CameraBus.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+
+#include <StartingPointInput/InputEventNotificationBus.h>
+
+namespace FirstPersonController
+{
+    // Carry system for the player: grabs the focused grabbable and moves it towards a target in front of the camera
+    // by setting its velocities each physics step, so the body stays dynamic and is never reparented
+    class FirstPersonCarryComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public Camera::CameraNotificationBus::Handler
+        , public StartingPointInput::InputEventNotificationBus::MultiHandler
+        , public FirstPersonCarryComponentRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(FirstPersonCarryComponent, "{7b3e0d95-a2c4-4816-9f1d-c85e4a6b2f07}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // TickBus interface
+        void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
+
+        // Camera::CameraNotificationBus
+        void OnActiveViewChanged(const AZ::EntityId& activeEntityId) override;
+
+        // AZ::InputEventNotificationBus interface
+        void OnPressed(float value) override;
+        void OnReleased(float value) override;
+
+        // FirstPersonCarryComponentRequestBus
+        AZ::EntityId GetHeldEntityId() const override;
+        bool Grab(const AZ::EntityId& entityId) override;
+        void Release() override;
+        void Throw() override;
+        bool GetIsInspecting() const override;
+        float GetHoldDistance() const override;
+        void SetHoldDistance(const float& new_holdDistance) override;
+        float GetBreakDistance() const override;
+        void SetBreakDistance(const float& new_breakDistance) override;
+        float GetThrowSpeed() const override;
+        void SetThrowSpeed(const float& new_throwSpeed) override;
+        float GetInspectSensitivity() const override;
+        void SetInspectSensitivity(const float& new_inspectSensitivity) override;
+
+    private:
+        void OnSceneSimulationStart(float physicsTimestep);
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimulationStartHandler;
+        AzPhysics::SceneHandle m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
+
+        void Drop(const bool& thrown);
+        void SetInspecting(const bool& inspecting);
+        void ConnectInputEvents();
+
+        // Input event assignment
+        AZStd::string m_strGrab = "Grab";
+        AZStd::string m_strThrow = "Throw";
+        AZStd::string m_strInspect = "Modify";
+        StartingPointInput::InputEventNotificationId m_grabEventId;
+        StartingPointInput::InputEventNotificationId m_throwEventId;
+        StartingPointInput::InputEventNotificationId m_inspectEventId;
+
+        // Carry settings
+        float m_holdDistance = 1.5f;
+        float m_breakDistance = 2.5f;
+        float m_throwSpeed = 10.f;
+        float m_inspectSensitivity = 0.0035f;
+
+        // Held entity state, the rotation is relative to the camera so that the entity turns with the view
+        AZ::EntityId m_activeCameraEntityId;
+        AZ::EntityId m_heldEntityId;
+        AZ::Quaternion m_holdLocalRotation = AZ::Quaternion::CreateIdentity();
+        float m_heldFollowRate = 0.f;
+        float m_heldMaxFollowSpeed = 0.f;
+        bool m_heldGravityEnabled = true;
+        bool m_heldInspectable = false;
+        bool m_inspecting = false;
+    };
+} // namespace FirstPersonController
@@ -4,18 +4,29 @@
 
 #include <Clients/FirstPersonControllerComponent.h>
 
+#include <FirstPersonController/CharacterTeleportBus.h>
+#include <FirstPersonController/FirstPersonControllerBus.h>
+#include <FirstPersonController/LadderComponentBus.h>
+
+#include <Clients/ControllerLod.h>
+#include <Clients/ControllerStepInputBus.h>
+#include <Clients/PhysicsSceneLookup.h>
+#include <Clients/VerticalVelocity.h>
+
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/EditContext.h>
 
 #include <AzFramework/Physics/RigidBodyBus.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
 #include <AzFramework/Physics/CollisionBus.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Input/Devices/Gamepad/InputDeviceGamepad.h>
 #include <AzFramework/Input/Devices/InputDeviceId.h>
+#include <AzFramework/Input/Events/InputChannelEventFilter.h>
 
 #include <PhysX/CharacterControllerBus.h>
 #include <System/PhysXSystem.h>
@@ -24,8 +35,205 @@ namespace FirstPersonController
 {
     using namespace StartingPointInput;
 
+    void FirstPersonControllerState::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<FirstPersonControllerState>()
+              ->Field("Forward Input Value", &FirstPersonControllerState::m_forwardValue)
+              ->Field("Back Input Value", &FirstPersonControllerState::m_backValue)
+              ->Field("Left Input Value", &FirstPersonControllerState::m_leftValue)
+              ->Field("Right Input Value", &FirstPersonControllerState::m_rightValue)
+              ->Field("Yaw Input Value", &FirstPersonControllerState::m_yawValue)
+              ->Field("Pitch Input Value", &FirstPersonControllerState::m_pitchValue)
+              ->Field("Sprint Input Value", &FirstPersonControllerState::m_sprintValue)
+              ->Field("Crouch Input Value", &FirstPersonControllerState::m_crouchValue)
+              ->Field("Jump Input Value", &FirstPersonControllerState::m_jumpValue)
+              ->Field("Forward Scale", &FirstPersonControllerState::m_forwardScale)
+              ->Field("Back Scale", &FirstPersonControllerState::m_backScale)
+              ->Field("Left Scale", &FirstPersonControllerState::m_leftScale)
+              ->Field("Right Scale", &FirstPersonControllerState::m_rightScale)
+              ->Field("Camera Yaw Sensitivity", &FirstPersonControllerState::m_yawSensitivity)
+              ->Field("Camera Pitch Sensitivity", &FirstPersonControllerState::m_pitchSensitivity)
+              ->Field("Top Walk Speed", &FirstPersonControllerState::m_topWalkSpeed)
+              ->Field("Gravity", &FirstPersonControllerState::m_gravity)
+              ->Field("Jump Initial Velocity", &FirstPersonControllerState::m_jumpInitialVelocity)
+              ->Field("Apply Velocity XY", &FirstPersonControllerState::m_applyVelocityXY)
+              ->Field("Apply Velocity Z", &FirstPersonControllerState::m_applyVelocityZ)
+              ->Field("Add Velocity World", &FirstPersonControllerState::m_addVelocityWorld)
+              ->Field("Add Velocity Heading", &FirstPersonControllerState::m_addVelocityHeading)
+              ->Field("Grounded", &FirstPersonControllerState::m_grounded)
+              ->Field("Ground Close", &FirstPersonControllerState::m_groundClose)
+              ->Field("Air Time", &FirstPersonControllerState::m_airTime)
+              ->Field("Heading", &FirstPersonControllerState::m_heading)
+              ->Field("Pitch", &FirstPersonControllerState::m_pitch)
+              ->Field("Crouched", &FirstPersonControllerState::m_crouched)
+              ->Field("Sprinting", &FirstPersonControllerState::m_sprinting)
+              ->Field("Stamina Percentage", &FirstPersonControllerState::m_staminaPercentage)
+              ->Field("Climbing Ladder", &FirstPersonControllerState::m_climbingLadder)
+              ->Version(1);
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->Class<FirstPersonControllerState>("FirstPersonControllerState")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Constructor()
+                ->Property("Forward Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_forwardValue))
+                ->Property("Back Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_backValue))
+                ->Property("Left Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_leftValue))
+                ->Property("Right Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_rightValue))
+                ->Property("Yaw Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_yawValue))
+                ->Property("Pitch Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_pitchValue))
+                ->Property("Sprint Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_sprintValue))
+                ->Property("Crouch Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_crouchValue))
+                ->Property("Jump Input Value", BehaviorValueProperty(&FirstPersonControllerState::m_jumpValue))
+                ->Property("Forward Scale", BehaviorValueProperty(&FirstPersonControllerState::m_forwardScale))
+                ->Property("Back Scale", BehaviorValueProperty(&FirstPersonControllerState::m_backScale))
+                ->Property("Left Scale", BehaviorValueProperty(&FirstPersonControllerState::m_leftScale))
+                ->Property("Right Scale", BehaviorValueProperty(&FirstPersonControllerState::m_rightScale))
+                ->Property("Camera Yaw Sensitivity", BehaviorValueProperty(&FirstPersonControllerState::m_yawSensitivity))
+                ->Property("Camera Pitch Sensitivity", BehaviorValueProperty(&FirstPersonControllerState::m_pitchSensitivity))
+                ->Property("Top Walk Speed", BehaviorValueProperty(&FirstPersonControllerState::m_topWalkSpeed))
+                ->Property("Gravity", BehaviorValueProperty(&FirstPersonControllerState::m_gravity))
+                ->Property("Jump Initial Velocity", BehaviorValueProperty(&FirstPersonControllerState::m_jumpInitialVelocity))
+                ->Property("Apply Velocity XY", BehaviorValueProperty(&FirstPersonControllerState::m_applyVelocityXY))
+                ->Property("Apply Velocity Z", BehaviorValueProperty(&FirstPersonControllerState::m_applyVelocityZ))
+                ->Property("Add Velocity World", BehaviorValueProperty(&FirstPersonControllerState::m_addVelocityWorld))
+                ->Property("Add Velocity Heading", BehaviorValueProperty(&FirstPersonControllerState::m_addVelocityHeading))
+                ->Property("Grounded", BehaviorValueGetter(&FirstPersonControllerState::m_grounded), nullptr)
+                ->Property("Ground Close", BehaviorValueGetter(&FirstPersonControllerState::m_groundClose), nullptr)
+                ->Property("Air Time", BehaviorValueGetter(&FirstPersonControllerState::m_airTime), nullptr)
+                ->Property("Heading", BehaviorValueGetter(&FirstPersonControllerState::m_heading), nullptr)
+                ->Property("Pitch", BehaviorValueGetter(&FirstPersonControllerState::m_pitch), nullptr)
+                ->Property("Crouched", BehaviorValueGetter(&FirstPersonControllerState::m_crouched), nullptr)
+                ->Property("Sprinting", BehaviorValueGetter(&FirstPersonControllerState::m_sprinting), nullptr)
+                ->Property("Stamina Percentage", BehaviorValueGetter(&FirstPersonControllerState::m_staminaPercentage), nullptr)
+                ->Property("Climbing Ladder", BehaviorValueGetter(&FirstPersonControllerState::m_climbingLadder), nullptr);
+        }
+    }
+
+    void InputOverride::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<InputOverride>()
+              ->Field("Priority", &InputOverride::m_priority)
+              ->Field("Mask", &InputOverride::m_mask)
+              ->Field("Ticks", &InputOverride::m_ticks)
+              ->Field("Forward Input Value", &InputOverride::m_forwardValue)
+              ->Field("Back Input Value", &InputOverride::m_backValue)
+              ->Field("Left Input Value", &InputOverride::m_leftValue)
+              ->Field("Right Input Value", &InputOverride::m_rightValue)
+              ->Field("Yaw Input Value", &InputOverride::m_yawValue)
+              ->Field("Pitch Input Value", &InputOverride::m_pitchValue)
+              ->Field("Sprint Input Value", &InputOverride::m_sprintValue)
+              ->Field("Crouch Input Value", &InputOverride::m_crouchValue)
+              ->Field("Jump Input Value", &InputOverride::m_jumpValue)
+              ->Version(1);
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->Class<InputOverride>("InputOverride")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Constructor()
+                ->Property("Priority", BehaviorValueProperty(&InputOverride::m_priority))
+                ->Property("Mask", BehaviorValueProperty(&InputOverride::m_mask))
+                ->Property("Ticks", BehaviorValueProperty(&InputOverride::m_ticks))
+                ->Property("Forward Input Value", BehaviorValueProperty(&InputOverride::m_forwardValue))
+                ->Property("Back Input Value", BehaviorValueProperty(&InputOverride::m_backValue))
+                ->Property("Left Input Value", BehaviorValueProperty(&InputOverride::m_leftValue))
+                ->Property("Right Input Value", BehaviorValueProperty(&InputOverride::m_rightValue))
+                ->Property("Yaw Input Value", BehaviorValueProperty(&InputOverride::m_yawValue))
+                ->Property("Pitch Input Value", BehaviorValueProperty(&InputOverride::m_pitchValue))
+                ->Property("Sprint Input Value", BehaviorValueProperty(&InputOverride::m_sprintValue))
+                ->Property("Crouch Input Value", BehaviorValueProperty(&InputOverride::m_crouchValue))
+                ->Property("Jump Input Value", BehaviorValueProperty(&InputOverride::m_jumpValue))
+                ->Enum<static_cast<int>(InputOverrideChannel::Forward)>("Forward Channel")
+                ->Enum<static_cast<int>(InputOverrideChannel::Back)>("Back Channel")
+                ->Enum<static_cast<int>(InputOverrideChannel::Left)>("Left Channel")
+                ->Enum<static_cast<int>(InputOverrideChannel::Right)>("Right Channel")
+                ->Enum<static_cast<int>(InputOverrideChannel::Yaw)>("Yaw Channel")
+                ->Enum<static_cast<int>(InputOverrideChannel::Pitch)>("Pitch Channel")
+                ->Enum<static_cast<int>(InputOverrideChannel::Sprint)>("Sprint Channel")
+                ->Enum<static_cast<int>(InputOverrideChannel::Crouch)>("Crouch Channel")
+                ->Enum<static_cast<int>(InputOverrideChannel::Jump)>("Jump Channel")
+                ->Enum<static_cast<int>(InputOverrideAllChannels)>("All Channels");
+        }
+    }
+
+    void GamepadInputSettings::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<GamepadInputSettings>()
+              ->Field("Enabled", &GamepadInputSettings::m_enabled)
+              ->Field("Inner Dead Zone", &GamepadInputSettings::m_innerDeadZone)
+              ->Field("Outer Dead Zone", &GamepadInputSettings::m_outerDeadZone)
+              ->Field("Move Response Exponent", &GamepadInputSettings::m_moveResponseExponent)
+              ->Field("Look Response Exponent", &GamepadInputSettings::m_lookResponseExponent)
+              ->Field("Look Yaw Speed", &GamepadInputSettings::m_lookYawSpeed)
+              ->Field("Look Pitch Speed", &GamepadInputSettings::m_lookPitchSpeed)
+              ->Field("Look Acceleration Scale", &GamepadInputSettings::m_lookAccelerationScale)
+              ->Field("Look Acceleration Time", &GamepadInputSettings::m_lookAccelerationTime)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                ec->Class<GamepadInputSettings>("Gamepad Input Settings", "Shaping of the gamepad thumbsticks")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_enabled,
+                        "Enable Gamepad", "Determines whether the left thumbstick moves the character and the right thumbstick rotates the camera.")
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_innerDeadZone,
+                        "Inner Dead Zone", "Thumbstick deflections below this fraction read as zero. The dead zone is radial so diagonals behave the same as the axes.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                        ->Attribute(AZ::Edit::Attributes::Max, 1.f)
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_outerDeadZone,
+                        "Outer Dead Zone", "Thumbstick deflections above this fraction read as full deflection.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                        ->Attribute(AZ::Edit::Attributes::Max, 1.f)
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_moveResponseExponent,
+                        "Move Response Exponent", "Exponent of the left thumbstick's response curve. Values above 1 give finer control of slow movement.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.1f)
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_lookResponseExponent,
+                        "Look Response Exponent", "Exponent of the right thumbstick's response curve. Values above 1 give finer aiming near the center.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.1f)
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_lookYawSpeed,
+                        "Look Yaw Speed (deg/s)", "Yaw rate at full deflection of the right thumbstick.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_lookPitchSpeed,
+                        "Look Pitch Speed (deg/s)", "Pitch rate at full deflection of the right thumbstick.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_lookAccelerationScale,
+                        "Look Acceleration Scale", "Factor the look rates ramp up to while the right thumbstick is held at full deflection.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1.f)
+                    ->DataElement(nullptr,
+                        &GamepadInputSettings::m_lookAccelerationTime,
+                        "Look Acceleration Time (s)", "Time at full deflection over which the look rates ramp up to the Look Acceleration Scale.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f);
+            }
+        }
+    }
+
     void FirstPersonControllerComponent::Reflect(AZ::ReflectContext* rc)
     {
+        FirstPersonControllerState::Reflect(rc);
+        InputOverride::Reflect(rc);
+        GamepadInputSettings::Reflect(rc);
+
         if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
         {
             sc->Class<FirstPersonControllerComponent, AZ::Component>()
@@ -81,6 +289,7 @@ namespace FirstPersonController
               ->Field("Crouch Jump Causes Standing", &FirstPersonControllerComponent::m_crouchJumpCausesStanding)
               ->Field("Crouch Sprint Causes Standing", &FirstPersonControllerComponent::m_crouchSprintCausesStanding)
               ->Field("Crouch Priority When Sprint Pressed", &FirstPersonControllerComponent::m_crouchPriorityWhenSprintPressed)
+              ->Field("Crouch Capsule Resize Quantum", &FirstPersonControllerComponent::m_capsuleResizeQuantum)
 
               // Jumping group
               ->Field("Grounded Collision Group", &FirstPersonControllerComponent::m_groundedCollisionGroupId)
@@ -104,6 +313,34 @@ namespace FirstPersonController
               ->Field("Update X&Y Velocity When Decending", &FirstPersonControllerComponent::m_updateXYDecending)
               ->Field("Update X&Y Velocity Only When Ground Close", &FirstPersonControllerComponent::m_updateXYOnlyNearGround)
 
+              // Moving Platforms group
+              ->Field("Inherit Platform Velocity", &FirstPersonControllerComponent::m_inheritPlatformVelocity)
+              ->Field("Platform Rotation Turns Character", &FirstPersonControllerComponent::m_platformRotationTurnsCharacter)
+
+              // Ladder group
+              ->Field("Enable Ladder Climbing", &FirstPersonControllerComponent::m_ladderClimbingEnabled)
+              ->Field("Ladder Climb Speed (m/s)", &FirstPersonControllerComponent::m_ladderClimbSpeed)
+              ->Field("Ladder Strafe Scale", &FirstPersonControllerComponent::m_ladderStrafeScale)
+              ->Field("Ladder Look Down Angle (degrees)", &FirstPersonControllerComponent::m_ladderLookDownAngle)
+              ->Field("Ladder Jump Off Speed (m/s)", &FirstPersonControllerComponent::m_ladderJumpOffSpeed)
+
+              // Level Of Detail group
+              ->Field("Enable LOD", &FirstPersonControllerComponent::m_lodEnabled)
+              ->Field("LOD Reduced Distance (m)", &FirstPersonControllerComponent::m_lodReducedDistance)
+              ->Field("LOD Minimal Distance (m)", &FirstPersonControllerComponent::m_lodMinimalDistance)
+              ->Field("LOD Reduced Step Interval", &FirstPersonControllerComponent::m_lodReducedStepInterval)
+              ->Field("LOD Minimal Step Interval", &FirstPersonControllerComponent::m_lodMinimalStepInterval)
+
+              // Scene Query Scheduling group
+              ->Field("Always Query Scene Casts", &FirstPersonControllerComponent::m_alwaysQuerySceneCasts)
+              ->Field("Query Scene Name", &FirstPersonControllerComponent::m_querySceneName)
+
+              // Notifications group
+              ->Field("Broadcast Notifications", &FirstPersonControllerComponent::m_broadcastNotifications)
+
+              // Gamepad group
+              ->Field("Gamepad", &FirstPersonControllerComponent::m_gamepadSettings)
+
               ->Version(1);
 
             if(AZ::EditContext* ec = sc->GetEditContext())
@@ -255,6 +492,10 @@ namespace FirstPersonController
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_crouchPriorityWhenSprintPressed,
                         "Crouch Priority When Sprint Pressed", "Determines whether pressing crouch while sprint is held causes the character to crouch.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_capsuleResizeQuantum,
+                        "Crouch Capsule Resize Quantum (m)", "Determines how much the capsule's height must change during a crouch or stand transition before the PhysX Character Controller is resized. The capsule is always resized at the end of a transition. Setting this to zero resizes the capsule on every step.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
 
                     ->ClassElement(AZ::Edit::ClassElements::Group, "Jumping")
                     ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
@@ -314,7 +555,81 @@ namespace FirstPersonController
                         "Update X&Y Velocity When Descending", "Allows movement in X&Y during a jump’s descent.")
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_updateXYOnlyNearGround,
-                        "Update X&Y Velocity Only When Ground Close", "Allows movement in X&Y only if close to an acceptable ground entity. According to the distance set in Jump Hold Distance. If the ascending and descending options are disabled, then this will effectively do nothing.");
+                        "Update X&Y Velocity Only When Ground Close", "Allows movement in X&Y only if close to an acceptable ground entity. According to the distance set in Jump Hold Distance. If the ascending and descending options are disabled, then this will effectively do nothing.")
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Moving Platforms")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_inheritPlatformVelocity,
+                        "Inherit Platform Velocity", "Determines whether the velocity of the ground entity the character stands on is added to the character's velocity, so that elevators and moving platforms carry the character without reparenting it. The rigid body's velocity is used when it has one, otherwise the velocity is obtained from the change in the ground entity's transform. Disable any script that reparents the character onto the platform when enabling this.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_platformRotationTurnsCharacter,
+                        "Platform Rotation Turns Character", "Determines whether the character's heading turns along with a platform that rotates about its vertical axis.")
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Ladder")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_ladderClimbingEnabled,
+                        "Enable Ladder Climbing", "Determines whether the character climbs when it enters a volume with a Ladder component. While climbing, gravity is suspended and the forward and back input moves the character up or down the ladder.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_ladderClimbSpeed,
+                        "Ladder Climb Speed (m/s)", "Speed at which the character moves up and down a ladder, this is multiplied by the ladder's Climb Speed Scale.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_ladderStrafeScale,
+                        "Ladder Strafe Scale", "Fraction of the climb speed used for the left and right movement while on a ladder.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_ladderLookDownAngle,
+                        "Ladder Look Down Angle (degrees)", "Once the camera is pitched further down than this angle, the forward input climbs down the ladder instead of up it, and the back input climbs up.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                        ->Attribute(AZ::Edit::Attributes::Max, 90.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_ladderJumpOffSpeed,
+                        "Ladder Jump Off Speed (m/s)", "Speed at which the character is pushed away from the ladder, opposite to its heading, when jumping while climbing.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Level Of Detail")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_lodEnabled,
+                        "Enable LOD", "Determines whether the controller reduces its update cost based on its distance to the active camera. This is intended for remote or AI controlled characters, the character being viewed through the active camera always runs at full detail.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_lodReducedDistance,
+                        "LOD Reduced Distance (m)", "Distance to the active camera beyond which the controller skips the ground close sphere cast and the camera rotation damping, and only steps once every LOD Reduced Step Interval.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_lodMinimalDistance,
+                        "LOD Minimal Distance (m)", "Distance to the active camera beyond which the controller additionally replaces the ground sphere cast with a single ray cast, and only steps once every LOD Minimal Step Interval.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_lodReducedStepInterval,
+                        "LOD Reduced Step Interval", "Number of ticks (or physics timesteps) per movement step at the reduced tier. The last velocity is reused in between steps.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_lodMinimalStepInterval,
+                        "LOD Minimal Step Interval", "Number of ticks (or physics timesteps) per movement step at the minimal tier. The last velocity is reused in between steps.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Scene Query Scheduling")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_alwaysQuerySceneCasts,
+                        "Always Query Scene Casts", "Determines whether the head and stand sphere casts run on every step. When disabled they only run when the movement state can use their result: the head cast while ascending or about to jump, and the stand cast while standing up. The ground close cast always shares the ground cast's sweep.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_querySceneName,
+                        "Query Scene Name", "Name of the physics scene that the ground, head and stand casts query. Leave empty to use the scene of the character's collider, or the default physics scene without one. The interaction and carry components use the same scene.")
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Notifications")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_broadcastNotifications,
+                        "Broadcast Notifications", "Determines whether the notifications are broadcast to every First Person Controller notification handler, as in earlier versions, rather than only to the handlers connected to this entity. It is enabled by default so that existing handlers keep working, disable it when every handler connects to its controller's entity since broadcasting is slower with many controllers and handlers.")
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Gamepad")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_gamepadSettings,
+                        "Gamepad", "Gamepad thumbstick settings.")
+                        ->Attribute(AZ::Edit::Attributes::Visibility, AZ::Edit::PropertyVisibility::ShowChildrenOnly);
             }
         }
 
@@ -600,7 +915,81 @@ namespace FirstPersonController
                 ->Event("Update Camera Pitch", &FirstPersonControllerComponentRequests::UpdateCameraPitch)
                 ->Event("Get Character Heading", &FirstPersonControllerComponentRequests::GetHeading)
                 ->Event("Set Character Heading For Tick", &FirstPersonControllerComponentRequests::SetHeadingForTick)
-                ->Event("Get Camera Pitch", &FirstPersonControllerComponentRequests::GetPitch);
+                ->Event("Get Camera Pitch", &FirstPersonControllerComponentRequests::GetPitch)
+                ->Event("Get LOD Enabled", &FirstPersonControllerComponentRequests::GetLodEnabled)
+                ->Event("Set LOD Enabled", &FirstPersonControllerComponentRequests::SetLodEnabled)
+                ->Event("Get LOD Reduced Distance", &FirstPersonControllerComponentRequests::GetLodReducedDistance)
+                ->Event("Set LOD Reduced Distance", &FirstPersonControllerComponentRequests::SetLodReducedDistance)
+                ->Event("Get LOD Minimal Distance", &FirstPersonControllerComponentRequests::GetLodMinimalDistance)
+                ->Event("Set LOD Minimal Distance", &FirstPersonControllerComponentRequests::SetLodMinimalDistance)
+                ->Event("Get LOD Reduced Step Interval", &FirstPersonControllerComponentRequests::GetLodReducedStepInterval)
+                ->Event("Set LOD Reduced Step Interval", &FirstPersonControllerComponentRequests::SetLodReducedStepInterval)
+                ->Event("Get LOD Minimal Step Interval", &FirstPersonControllerComponentRequests::GetLodMinimalStepInterval)
+                ->Event("Set LOD Minimal Step Interval", &FirstPersonControllerComponentRequests::SetLodMinimalStepInterval)
+                ->Event("Get LOD Tier", &FirstPersonControllerComponentRequests::GetLodTier)
+                ->Event("Get Capsule Resize Quantum", &FirstPersonControllerComponentRequests::GetCapsuleResizeQuantum)
+                ->Event("Set Capsule Resize Quantum", &FirstPersonControllerComponentRequests::SetCapsuleResizeQuantum)
+                ->Event("Get Capsule Resizes Saved Last Transition", &FirstPersonControllerComponentRequests::GetCapsuleResizesSavedLastTransition)
+                ->Event("Get Look Input Redirected", &FirstPersonControllerComponentRequests::GetLookInputRedirected)
+                ->Event("Set Look Input Redirected", &FirstPersonControllerComponentRequests::SetLookInputRedirected)
+                ->Event("Get Gamepad Look Delta", &FirstPersonControllerComponentRequests::GetGamepadLookDelta)
+                ->Event("Get Inherit Platform Velocity", &FirstPersonControllerComponentRequests::GetInheritPlatformVelocity)
+                ->Event("Set Inherit Platform Velocity", &FirstPersonControllerComponentRequests::SetInheritPlatformVelocity)
+                ->Event("Get Platform Rotation Turns Character", &FirstPersonControllerComponentRequests::GetPlatformRotationTurnsCharacter)
+                ->Event("Set Platform Rotation Turns Character", &FirstPersonControllerComponentRequests::SetPlatformRotationTurnsCharacter)
+                ->Event("Get Platform EntityId", &FirstPersonControllerComponentRequests::GetPlatformEntityId)
+                ->Event("Get Platform Velocity", &FirstPersonControllerComponentRequests::GetPlatformVelocity)
+                ->Event("Enter Ladder", &FirstPersonControllerComponentRequests::EnterLadder)
+                ->Event("Exit Ladder", &FirstPersonControllerComponentRequests::ExitLadder)
+                ->Event("Get Climbing Ladder", &FirstPersonControllerComponentRequests::GetClimbingLadder)
+                ->Event("Get Ladder Entity Id", &FirstPersonControllerComponentRequests::GetLadderEntityId)
+                ->Event("Get Ladder Climbing Enabled", &FirstPersonControllerComponentRequests::GetLadderClimbingEnabled)
+                ->Event("Set Ladder Climbing Enabled", &FirstPersonControllerComponentRequests::SetLadderClimbingEnabled)
+                ->Event("Get Ladder Climb Speed", &FirstPersonControllerComponentRequests::GetLadderClimbSpeed)
+                ->Event("Set Ladder Climb Speed", &FirstPersonControllerComponentRequests::SetLadderClimbSpeed)
+                ->Event("Get Ladder Strafe Scale", &FirstPersonControllerComponentRequests::GetLadderStrafeScale)
+                ->Event("Set Ladder Strafe Scale", &FirstPersonControllerComponentRequests::SetLadderStrafeScale)
+                ->Event("Get Ladder Look Down Angle", &FirstPersonControllerComponentRequests::GetLadderLookDownAngle)
+                ->Event("Set Ladder Look Down Angle", &FirstPersonControllerComponentRequests::SetLadderLookDownAngle)
+                ->Event("Get Ladder Jump Off Speed", &FirstPersonControllerComponentRequests::GetLadderJumpOffSpeed)
+                ->Event("Set Ladder Jump Off Speed", &FirstPersonControllerComponentRequests::SetLadderJumpOffSpeed)
+                ->Event("Teleport", &FirstPersonControllerComponentRequests::Teleport)
+                ->Event("Reset Velocity", &FirstPersonControllerComponentRequests::ResetVelocity)
+                ->Event("Launch", &FirstPersonControllerComponentRequests::Launch)
+                ->Event("Get Always Query Scene Casts", &FirstPersonControllerComponentRequests::GetAlwaysQuerySceneCasts)
+                ->Event("Set Always Query Scene Casts", &FirstPersonControllerComponentRequests::SetAlwaysQuerySceneCasts)
+                ->Event("Get Issued Scene Casts Per Second", &FirstPersonControllerComponentRequests::GetIssuedSceneCastsPerSecond)
+                ->Event("Get Skipped Scene Casts Per Second", &FirstPersonControllerComponentRequests::GetSkippedSceneCastsPerSecond)
+                ->Event("Get Query Scene Name", &FirstPersonControllerComponentRequests::GetQuerySceneName)
+                ->Event("Set Query Scene Name", &FirstPersonControllerComponentRequests::SetQuerySceneName)
+                ->Event("Get Broadcast Notifications", &FirstPersonControllerComponentRequests::GetBroadcastNotifications)
+                ->Event("Set Broadcast Notifications", &FirstPersonControllerComponentRequests::SetBroadcastNotifications)
+                ->Event("Get State Snapshot", &FirstPersonControllerComponentRequests::GetStateSnapshot)
+                ->Event("Apply State Overrides", &FirstPersonControllerComponentRequests::ApplyStateOverrides)
+                ->Event("Push Input Override", &FirstPersonControllerComponentRequests::PushInputOverride)
+                ->Event("Pop Input Override", &FirstPersonControllerComponentRequests::PopInputOverride)
+                ->Event("Clear Input Overrides", &FirstPersonControllerComponentRequests::ClearInputOverrides)
+                ->Event("Get Input Override Count", &FirstPersonControllerComponentRequests::GetInputOverrideCount)
+                ->Event("Get Gamepad Enabled", &FirstPersonControllerComponentRequests::GetGamepadEnabled)
+                ->Event("Set Gamepad Enabled", &FirstPersonControllerComponentRequests::SetGamepadEnabled)
+                ->Event("Get Gamepad Inner Dead Zone", &FirstPersonControllerComponentRequests::GetGamepadInnerDeadZone)
+                ->Event("Set Gamepad Inner Dead Zone", &FirstPersonControllerComponentRequests::SetGamepadInnerDeadZone)
+                ->Event("Get Gamepad Outer Dead Zone", &FirstPersonControllerComponentRequests::GetGamepadOuterDeadZone)
+                ->Event("Set Gamepad Outer Dead Zone", &FirstPersonControllerComponentRequests::SetGamepadOuterDeadZone)
+                ->Event("Get Gamepad Move Response Exponent", &FirstPersonControllerComponentRequests::GetGamepadMoveResponseExponent)
+                ->Event("Set Gamepad Move Response Exponent", &FirstPersonControllerComponentRequests::SetGamepadMoveResponseExponent)
+                ->Event("Get Gamepad Look Response Exponent", &FirstPersonControllerComponentRequests::GetGamepadLookResponseExponent)
+                ->Event("Set Gamepad Look Response Exponent", &FirstPersonControllerComponentRequests::SetGamepadLookResponseExponent)
+                ->Event("Get Gamepad Look Yaw Speed", &FirstPersonControllerComponentRequests::GetGamepadLookYawSpeed)
+                ->Event("Set Gamepad Look Yaw Speed", &FirstPersonControllerComponentRequests::SetGamepadLookYawSpeed)
+                ->Event("Get Gamepad Look Pitch Speed", &FirstPersonControllerComponentRequests::GetGamepadLookPitchSpeed)
+                ->Event("Set Gamepad Look Pitch Speed", &FirstPersonControllerComponentRequests::SetGamepadLookPitchSpeed)
+                ->Event("Get Gamepad Look Acceleration Scale", &FirstPersonControllerComponentRequests::GetGamepadLookAccelerationScale)
+                ->Event("Set Gamepad Look Acceleration Scale", &FirstPersonControllerComponentRequests::SetGamepadLookAccelerationScale)
+                ->Event("Get Gamepad Look Acceleration Time", &FirstPersonControllerComponentRequests::GetGamepadLookAccelerationTime)
+                ->Event("Set Gamepad Look Acceleration Time", &FirstPersonControllerComponentRequests::SetGamepadLookAccelerationTime)
+                ->Event("Get Received Input Events Per Second", &FirstPersonControllerComponentRequests::GetReceivedInputEventsPerSecond)
+                ->Event("Get Changed Input Events Per Second", &FirstPersonControllerComponentRequests::GetChangedInputEventsPerSecond);
 
             bc->Class<FirstPersonControllerComponent>()->RequestBus("FirstPersonControllerComponentRequestBus");
         }
@@ -608,29 +997,31 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::Activate()
     {
-        if(m_addVelocityForTimestepVsTick)
+        // The scene used by the ground, head and stand casts is resolved once rather than on every step,
+        // and again whenever a physics scene is added or removed
+        ResolveQueryScene();
+        if(auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
         {
-            Physics::DefaultWorldBus::BroadcastResult(m_attachedSceneHandle, &Physics::DefaultWorldRequests::GetDefaultSceneHandle);
-            if(m_attachedSceneHandle == AzPhysics::InvalidSceneHandle)
-            {
-                AZ_Error("First Person Controller Component", false, "Failed to retrieve default scene.");
-                return;
-            }
-
-            m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
-                [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            m_sceneAddedHandler = AzPhysics::SystemEvents::OnSceneAddedEvent::Handler(
+                [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle)
                 {
-                    OnSceneSimulationStart(fixedDeltaTime);
-                }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
-
-            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-
-            if(sceneInterface != nullptr)
-            {
-                sceneInterface->RegisterSceneSimulationStartHandler(m_attachedSceneHandle, m_sceneSimulationStartHandler);
-            }
+                    ResolveQueryScene();
+                    AttachStepping();
+                });
+            m_sceneRemovedHandler = AzPhysics::SystemEvents::OnSceneRemovedEvent::Handler(
+                [this](AzPhysics::SceneHandle sceneHandle)
+                {
+                    if(sceneHandle != m_querySceneHandle)
+                        return;
+                    m_querySceneHandle = AzPhysics::InvalidSceneHandle;
+                    AttachStepping();
+                });
+            physicsSystem->RegisterSceneAddedEvent(m_sceneAddedHandler);
+            physicsSystem->RegisterSceneRemovedEvent(m_sceneRemovedHandler);
         }
 
+        AttachStepping();
+
         // The charcter controller needs to be activated in order to obtain the
         // PhysX Chartacter Controller Component's attributes
         Physics::CharacterNotificationBus::Handler::BusConnect(GetEntityId());
@@ -643,13 +1034,7 @@ namespace FirstPersonController
 
         AssignConnectInputEvents();
 
-        AZ::TickBus::Handler::BusConnect();
-
-        InputChannelEventListener::Connect();
-        // Attempting to allow all possible input events through without filtering anything out
-        // This may not be necessary
-        AZStd::shared_ptr<AzFramework::InputChannelEventFilterInclusionList> filter;
-        AzFramework::InputChannelEventListener::SetFilter(filter);
+        UpdateInputChannelFilter();
 
         FirstPersonControllerComponentRequestBus::Handler::BusConnect(GetEntityId());
     }
@@ -666,8 +1051,13 @@ namespace FirstPersonController
             &PhysX::CharacterControllerRequestBus::Events::GetRadius);
         Physics::CharacterRequestBus::EventResult(m_maxGroundedAngleDegrees, GetEntityId(),
             &Physics::CharacterRequestBus::Events::GetSlopeLimitDegrees);
+        Physics::CharacterRequestBus::EventResult(m_stepHeight, GetEntityId(),
+            &Physics::CharacterRequestBus::Events::GetStepHeight);
 
         m_capsuleCurrentHeight = m_capsuleHeight;
+        m_capsuleResizedHeight = m_capsuleHeight;
+        m_capsuleResizeDirection = 0;
+        m_capsuleResizesSkipped = 0;
 
         if(m_crouchDistance > m_capsuleHeight - 2.f*m_capsuleRadius)
             m_crouchDistance = m_capsuleHeight - 2.f*m_capsuleRadius;
@@ -692,11 +1082,21 @@ namespace FirstPersonController
         InputChannelEventListener::Disconnect();
         FirstPersonControllerComponentRequestBus::Handler::BusDisconnect();
 
-        if(m_addVelocityForTimestepVsTick)
-        {
-            m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
-            m_sceneSimulationStartHandler.Disconnect();
-        }
+        if(auto* stepScheduler = ControllerStepSchedulerInterface::Get())
+            stepScheduler->RemoveController(this);
+        m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
+        m_sceneSimulationStartHandler.Disconnect();
+
+        m_sceneAddedHandler.Disconnect();
+        m_sceneRemovedHandler.Disconnect();
+        m_sceneInterface = nullptr;
+        m_querySceneHandle = AzPhysics::InvalidSceneHandle;
+
+        m_queuedNotifications.Clear();
+        RestoreOverriddenInput();
+
+        m_gamepadLeftStick = m_gamepadRightStick = m_gamepadMove = m_gamepadLookDelta = AZ::Vector2::CreateZero();
+        m_gamepadInput.Reset();
     }
 
     void FirstPersonControllerComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
@@ -812,56 +1212,69 @@ namespace FirstPersonController
         }
     }
 
-    bool FirstPersonControllerComponent::OnInputChannelEventFiltered(const AzFramework::InputChannel& inputChannel)
+    void FirstPersonControllerComponent::UpdateInputChannelFilter()
     {
-        const AzFramework::InputDeviceId& deviceId = inputChannel.GetInputDevice().GetInputDeviceId();
+        // The keyboard, mouse and gamepad button bindings arrive through StartingPointInput's input events,
+        // so the listener is only needed for the gamepad thumbsticks and only while the gamepad is enabled
+        if(!m_gamepadSettings.m_enabled)
+        {
+            InputChannelEventListener::Disconnect();
+            m_gamepadLeftStick = m_gamepadRightStick = AZ::Vector2::CreateZero();
+            return;
+        }
+
+        const AZ::Crc32 gamepadNameCrc = AzFramework::InputDeviceGamepad::IdForIndex0.GetNameCrc32();
+        auto filter = AZStd::make_shared<AzFramework::InputChannelEventFilterInclusionList>(
+            AzFramework::InputDeviceGamepad::ThumbStickAxis1D::LX.GetNameCrc32(), gamepadNameCrc);
+        filter->IncludeChannelName(AzFramework::InputDeviceGamepad::ThumbStickAxis1D::LY.GetNameCrc32());
+        filter->IncludeChannelName(AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RX.GetNameCrc32());
+        filter->IncludeChannelName(AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RY.GetNameCrc32());
+
+        InputChannelEventListener::SetFilter(filter);
+        InputChannelEventListener::Connect();
+    }
 
-        // TODO: Implement gamepad support
-        //AZ_Printf("", "OnInputChannelEventFiltered");
-        if(AzFramework::InputDeviceGamepad::IsGamepadDevice(deviceId))
-            OnGamepadEvent(inputChannel);
+    bool FirstPersonControllerComponent::OnInputChannelEventFiltered(const AzFramework::InputChannel& inputChannel)
+    {
+        ++m_inputEventsReceivedAccum;
+        if(OnGamepadEvent(inputChannel))
+            ++m_inputEventsChangedAccum;
 
         return false;
     }
 
-    void FirstPersonControllerComponent::OnGamepadEvent(const AzFramework::InputChannel& inputChannel)
+    bool FirstPersonControllerComponent::OnGamepadEvent(const AzFramework::InputChannel& inputChannel)
     {
-        // TODO: Implement gamepad support
+        // Only the latest value of each thumbstick axis is kept, ProcessGamepadInput uses them once per tick.
+        // Returns whether the event changed a cached value, held sticks repeat their value every frame.
         const AzFramework::InputChannelId& channelId = inputChannel.GetInputChannelId();
+        const AZ::Vector2 leftStick = m_gamepadLeftStick;
+        const AZ::Vector2 rightStick = m_gamepadRightStick;
 
-        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickDirection::LR)
-        {
-            m_rightValue = inputChannel.GetValue();
-            m_leftValue = 0.f;
-        }
-        else if(channelId == AzFramework::InputDeviceGamepad::ThumbStickDirection::LL)
-        {
-            m_rightValue = 0.f;
-            m_leftValue = inputChannel.GetValue();
-        }
+        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::LX)
+            m_gamepadLeftStick.SetX(inputChannel.GetValue());
+        else if(channelId == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::LY)
+            m_gamepadLeftStick.SetY(inputChannel.GetValue());
+        else if(channelId == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RX)
+            m_gamepadRightStick.SetX(inputChannel.GetValue());
+        else if(channelId == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RY)
+            m_gamepadRightStick.SetY(inputChannel.GetValue());
 
-        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickDirection::LU)
-        {
-            m_forwardValue = inputChannel.GetValue();
-            m_backValue = 0.f;
-        }
-        else if(channelId == AzFramework::InputDeviceGamepad::ThumbStickDirection::LD)
-        {
-            m_forwardValue = 0.f;
-            m_backValue = inputChannel.GetValue();
-        }
+        return m_gamepadLeftStick != leftStick || m_gamepadRightStick != rightStick;
+    }
 
-        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RX)
+    void FirstPersonControllerComponent::ProcessGamepadInput(const float& deltaTime)
+    {
+        if(!m_gamepadSettings.m_enabled)
         {
-            m_cameraRotationAngles[2] = -1.f*inputChannel.GetValue() * m_yawSensitivity;
-            m_rotatingYawViaScriptGamepad = true;
+            m_gamepadMove = m_gamepadLookDelta = AZ::Vector2::CreateZero();
+            return;
         }
 
-        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RY)
-        {
-            m_cameraRotationAngles[0] = inputChannel.GetValue() * m_pitchSensitivity;
-            m_rotatingPitchViaScriptGamepad = true;
-        }
+        // The movement is kept apart from the keyboard's input values, ApplyInputOverrides() combines the two for each step
+        m_gamepadMove = m_gamepadInput.GetMoveInput(m_gamepadSettings, m_gamepadLeftStick);
+
+        m_gamepadLookDelta = m_gamepadInput.UpdateLook(m_gamepadSettings, m_gamepadRightStick, deltaTime);
     }
 
     void FirstPersonControllerComponent::OnTick(float deltaTime, AZ::ScriptTimePoint)
@@ -888,21 +1301,38 @@ namespace FirstPersonController
     {
         // Multiply by -1 since moving the mouse to the right produces a positive value
         // but a positive rotation about Z is counterclockwise
+        // The gamepad look rotation is added unless an input override replaces the look input
         if(!m_rotatingYawViaScriptGamepad)
+        {
             m_cameraRotationAngles[2] = -1.f * m_yawValue * m_yawSensitivity;
+            if(!(m_overriddenInputMask & static_cast<AZ::u32>(InputOverrideChannel::Yaw)))
+                m_cameraRotationAngles[2] -= m_gamepadLookDelta.GetX();
+        }
         else
             m_rotatingYawViaScriptGamepad = false;
 
         // Multiply by -1 since moving the mouse up produces a negative value from the input bus
         if(!m_rotatingPitchViaScriptGamepad)
+        {
             m_cameraRotationAngles[0] = -1.f * m_pitchValue * m_pitchSensitivity;
+            if(!(m_overriddenInputMask & static_cast<AZ::u32>(InputOverrideChannel::Pitch)))
+                m_cameraRotationAngles[0] += m_gamepadLookDelta.GetY();
+        }
         else
             m_rotatingPitchViaScriptGamepad = false;
 
+        // The gamepad look delta stays available through GetGamepadLookDelta() for the component the look input is redirected to
+        if(m_lookInputRedirected)
+        {
+            m_cameraRotationAngles[0] = 0.f;
+            m_cameraRotationAngles[2] = 0.f;
+        }
+
         const AZ::Quaternion targetLookRotationDelta = AZ::Quaternion::CreateFromEulerAnglesRadians(
             AZ::Vector3::CreateFromFloat3(m_cameraRotationAngles));
 
-        if(m_rotationDamp*deltaTime <= 1.f)
+        // Camera rotation damping is skipped for controllers that are far from the active camera
+        if(m_lodTier == LodTier::Full && m_rotationDamp*deltaTime <= 1.f)
         {
             if(m_cameraSlerpInsteadOfLerpRotation)
                 m_newLookRotationDelta = m_newLookRotationDelta.Slerp(targetLookRotationDelta, m_rotationDamp*deltaTime);
@@ -922,7 +1352,7 @@ namespace FirstPersonController
 
         t->RotateAroundLocalZ(newLookRotationDelta.GetZ());
 
-        m_activeCameraEntity = GetActiveCameraEntityPtr();
+        // The active camera entity was obtained on this tick by UpdateLodTier()
         t = m_activeCameraEntity->GetTransform();
 
         t->SetLocalRotation(AZ::Vector3(AZ::GetClamp(t->GetLocalRotation().GetX()+newLookRotationDelta.GetX(),
@@ -1046,23 +1476,23 @@ namespace FirstPersonController
             m_sprintAccumulatedAccel = 0.f;
 
         if(m_applyVelocityXY == AZ::Vector2::CreateZero())
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStartedMoving);
+            QueueNotification(&FirstPersonControllerNotifications::OnStartedMoving);
 
         if(newVelocityXY == targetVelocityXY)
         {
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTargetVelocityReached);
+            QueueNotification(&FirstPersonControllerNotifications::OnTargetVelocityReached);
 
             const bool vXCrossYPos = (m_velocityXCrossYDirection.GetZ() >= 0.f);
             if(newVelocityXY.GetLength() == 0.f)
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStopped);
+                QueueNotification(&FirstPersonControllerNotifications::OnStopped);
             else if(vXCrossYPos && (newVelocityXY.GetLength() == m_speed * CreateEllipseScaledVector(newVelocityXY.GetNormalized(), m_forwardScale, m_backScale, m_leftScale, m_rightScale).GetLength()))
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTopWalkSpeedReached);
+                QueueNotification(&FirstPersonControllerNotifications::OnTopWalkSpeedReached);
             else if(!vXCrossYPos && (newVelocityXY.GetLength() == m_speed * CreateEllipseScaledVector((-newVelocityXY).GetNormalized(), m_forwardScale, m_backScale, m_leftScale, m_rightScale).GetLength()))
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTopWalkSpeedReached);
+                QueueNotification(&FirstPersonControllerNotifications::OnTopWalkSpeedReached);
             else if(vXCrossYPos && newVelocityXY.GetLength() == m_speed * CreateEllipseScaledVector(newVelocityXY.GetNormalized(), m_sprintScaleForward*m_forwardScale, m_sprintScaleBack*m_backScale, m_sprintScaleLeft*m_leftScale, m_sprintScaleRight*m_rightScale).GetLength())
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTopSprintSpeedReached);
+                QueueNotification(&FirstPersonControllerNotifications::OnTopSprintSpeedReached);
             else if(!vXCrossYPos && newVelocityXY.GetLength() == m_speed * CreateEllipseScaledVector((-newVelocityXY).GetNormalized(), m_sprintScaleForward*m_forwardScale, m_sprintScaleBack*m_backScale, m_sprintScaleLeft*m_leftScale, m_sprintScaleRight*m_rightScale).GetLength())
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTopSprintSpeedReached);
+                QueueNotification(&FirstPersonControllerNotifications::OnTopSprintSpeedReached);
         }
 
         return newVelocityXY;
@@ -1156,7 +1586,7 @@ namespace FirstPersonController
         }
 
         if(m_sprintPrevValue == 0.f && !AZ::IsClose(m_sprintVelocityAdjust, 1.f) && m_sprintHeldDuration < m_sprintMaxTime && m_sprintCooldown == 0.f)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnSprintStarted);
+            QueueNotification(&FirstPersonControllerNotifications::OnSprintStarted);
 
         m_sprintPrevValue = m_sprintValue;
 
@@ -1199,7 +1629,7 @@ namespace FirstPersonController
             if(m_sprintHeldDuration >= m_sprintMaxTime)
             {
                 m_sprintHeldDuration = m_sprintMaxTime;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStaminaReachedZero);
+                QueueNotification(&FirstPersonControllerNotifications::OnStaminaReachedZero);
             }
 
             m_sprintPause = m_sprintPauseTime;
@@ -1270,7 +1700,7 @@ namespace FirstPersonController
             {
                 m_sprintVelocityAdjust = 1.f;
                 m_sprintCooldown = m_sprintCooldownTime;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnCooldownStarted);
+                QueueNotification(&FirstPersonControllerNotifications::OnCooldownStarted);
             }
 
             m_sprintPause -= deltaTime;
@@ -1290,7 +1720,7 @@ namespace FirstPersonController
                 if(m_sprintHeldDuration <= 0.f)
                 {
                     m_sprintHeldDuration = 0.f;
-                    FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStaminaCapped);
+                    QueueNotification(&FirstPersonControllerNotifications::OnStaminaCapped);
                 }
             }
             else
@@ -1303,12 +1733,12 @@ namespace FirstPersonController
                 {
                     m_sprintCooldown = 0.f;
                     m_sprintPause = 0.f;
-                    FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnCooldownDone);
+                    QueueNotification(&FirstPersonControllerNotifications::OnCooldownDone);
                     if(m_regenerateStaminaAutomatically)
                     {
                         m_sprintHeldDuration = 0.f;
                         m_staminaIncreasing = true;
-                        FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStaminaCapped);
+                        QueueNotification(&FirstPersonControllerNotifications::OnStaminaCapped);
                     }
                 }
             }
@@ -1328,20 +1758,7 @@ namespace FirstPersonController
 
         AZ::TransformInterface* cameraTransform = m_activeCameraEntity->GetTransform();
 
-        if(m_crouchEnableToggle && !m_crouchScriptLocked && m_crouchPrevValue == 0.f && m_crouchValue == 1.f)
-        {
-            m_crouching = !m_crouching;
-        }
-        else if(!m_crouchEnableToggle && !m_crouchScriptLocked)
-        {
-            if(m_crouchValue != 0.f
-                 && ((m_sprintValue == 0.f || !m_crouchSprintCausesStanding)
-                  || ((m_crouchPriorityWhenSprintPressed) && (m_standing || (m_crouching && !m_crouched))))
-                 && (m_jumpValue == 0.f || !m_crouchJumpCausesStanding || (m_jumpReqRepress && (m_standing || m_crouching))))
-                m_crouching = true;
-            else
-                m_crouching = false;
-        }
+        m_crouching = CrouchingNextStep();
 
         // If the crouch key takes priority when the sprint key is held and we're attempting to crouch
         // while the sprint key is being pressed then stop the sprinting and continue crouching
@@ -1351,13 +1768,6 @@ namespace FirstPersonController
                 && m_crouching
                 && m_cameraLocalZTravelDistance > -1.f * m_crouchDistance)
             m_sprintValue = 0.f;
-        // Otherwise if the crouch key does not take priority when the sprint key is held,
-        // and we are attempting to crouch while the sprint key is held, then do not crouch
-        else if(!m_crouchPriorityWhenSprintPressed
-            && m_sprintValue != 0.f
-            && m_crouching
-            && m_cameraLocalZTravelDistance > -1.f * m_crouchDistance)
-           m_crouching = false;
 
         //AZ_Printf("", "m_crouching = %s", m_crouching ? "true" : "false");
 
@@ -1368,7 +1778,7 @@ namespace FirstPersonController
                 m_standing = false;
 
             if(m_cameraLocalZTravelDistance == 0.f)
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStartedCrouching);
+                QueueNotification(&FirstPersonControllerNotifications::OnStartedCrouching);
 
             float cameraTravelDelta = -1.f * m_crouchDistance * deltaTime / m_crouchTime;
             m_cameraLocalZTravelDistance += cameraTravelDelta;
@@ -1378,74 +1788,52 @@ namespace FirstPersonController
                 cameraTravelDelta += abs(m_cameraLocalZTravelDistance) - m_crouchDistance;
                 m_cameraLocalZTravelDistance = -1.f * m_crouchDistance;
                 m_crouched = true;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnCrouched);
+                QueueNotification(&FirstPersonControllerNotifications::OnCrouched);
             }
 
-            // Adjust the height of the collider capsule based on the crouching height
-            PhysX::CharacterControllerRequestBus::EventResult(m_capsuleCurrentHeight, GetEntityId(),
-                &PhysX::CharacterControllerRequestBus::Events::GetHeight);
-
-            float stepHeight = 0.f;
-            Physics::CharacterRequestBus::EventResult(stepHeight, GetEntityId(),
-                &Physics::CharacterRequestBus::Events::GetStepHeight);
-
-            // Subtract the distance to get down to the crouching height
+            // Adjust the height of the collider capsule based on the crouching height,
+            // subtract the distance to get down to the crouching height
             m_capsuleCurrentHeight += cameraTravelDelta;
             if(m_capsuleCurrentHeight < (2.f*m_capsuleRadius + 0.00001f))
                 m_capsuleCurrentHeight = 2.f*m_capsuleRadius + 0.00001f;
-            if(m_capsuleCurrentHeight < (stepHeight + 0.00001f))
-                m_capsuleCurrentHeight = stepHeight + 0.00001f;
+            if(m_capsuleCurrentHeight < (m_stepHeight + 0.00001f))
+                m_capsuleCurrentHeight = m_stepHeight + 0.00001f;
             //AZ_Printf("", "Crouching capsule height = %.10f", m_capsuleCurrentHeight);
 
-            PhysX::CharacterControllerRequestBus::Event(GetEntityId(),
-                &PhysX::CharacterControllerRequestBus::Events::Resize, m_capsuleCurrentHeight);
+            ResizeCapsule(-1, m_crouched);
 
             cameraTransform->SetLocalZ(cameraTransform->GetLocalZ() + cameraTravelDelta);
         }
         // Stand up
         else if(!m_crouching && m_cameraLocalZTravelDistance != 0.f)
         {
+            // The character landed this step so the stand sphere cast wasn't planned, standing up is attempted on the next step
+            if(!m_standQueryPlanned && !m_standPreventedViaScript)
+            {
+                m_crouchPrevValue = m_crouchValue;
+                FlushCapsuleResize();
+                return;
+            }
+
             if(m_crouched)
                 m_crouched = false;
 
             if(m_cameraLocalZTravelDistance == -1.f * m_crouchDistance)
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStartedStanding);
-
-            // Create a shapecast sphere that will be used to detect whether there is an obstruction
-            // above the players head, and prevent them from fully standing up if there is
-            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-
-            AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
+                QueueNotification(&FirstPersonControllerNotifications::OnStartedStanding);
 
-            // Move the sphere to the location of the character and apply the Z offset
-            sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius));
-
-            AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ();
-
-            // Adjust the pose and direction of the sphere cast based on m_sphereCastsAxisDirectionPose
-            if(m_sphereCastsAxisDirectionPose != AZ::Vector3::CreateAxisZ())
+            // Standing up is already prevented from script, so the stand sphere cast wasn't planned
+            if(m_standPreventedViaScript && !m_standQueryPlanned)
             {
-                sphereCastDirection = m_sphereCastsAxisDirectionPose;
-                if(m_sphereCastsAxisDirectionPose.GetZ() >= 0.f)
-                    sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius)));
-                else
-                    sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius)));
+                m_standPreventedEntityIds.clear();
+                m_crouchPrevValue = m_crouchValue;
+                m_standPrevented = true;
+                QueueNotification(&FirstPersonControllerNotifications::OnStandPrevented);
+                FlushCapsuleResize();
+                return;
             }
 
-            AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-
-                m_capsuleRadius,
-                sphereCastPose,
-                sphereCastDirection,
-                m_uncrouchHeadSphereCastOffset,
-                AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-                m_standCollisionGroup,
-                nullptr);
-
-            request.m_reportMultipleHits = true;
-
-            AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-            AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+            // Check for an obstruction above the player's head that prevents them from fully standing up
+            AzPhysics::SceneQueryHits hits = m_standQueryHits;
 
             // Disregard intersections with the character's collider and its child entities,
             auto selfChildEntityCheck = [this](AzPhysics::SceneQueryHit& hit)
@@ -1494,7 +1882,8 @@ namespace FirstPersonController
             {
                 m_crouchPrevValue = m_crouchValue;
                 m_standPrevented = true;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStandPrevented);
+                QueueNotification(&FirstPersonControllerNotifications::OnStandPrevented);
+                FlushCapsuleResize();
                 return;
             }
             m_standPrevented = false;
@@ -1507,21 +1896,17 @@ namespace FirstPersonController
                 cameraTravelDelta -= m_cameraLocalZTravelDistance;
                 m_cameraLocalZTravelDistance = 0.f;
                 m_standing = true;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStoodUp);
+                QueueNotification(&FirstPersonControllerNotifications::OnStoodUp);
             }
 
-            // Adjust the height of the collider capsule based on the standing height
-            PhysX::CharacterControllerRequestBus::EventResult(m_capsuleCurrentHeight, GetEntityId(),
-                &PhysX::CharacterControllerRequestBus::Events::GetHeight);
-
-            // Add the distance to get back to the standing height
+            // Adjust the height of the collider capsule based on the standing height,
+            // add the distance to get back to the standing height
             m_capsuleCurrentHeight += cameraTravelDelta;
             if(m_capsuleCurrentHeight > m_capsuleHeight)
                 m_capsuleCurrentHeight = m_capsuleHeight;
             //AZ_Printf("", "Standing capsule height = %.10f", m_capsuleCurrentHeight);
 
-            PhysX::CharacterControllerRequestBus::Event(GetEntityId(),
-                &PhysX::CharacterControllerRequestBus::Events::Resize, m_capsuleCurrentHeight);
+            ResizeCapsule(1, m_standing);
 
             cameraTransform->SetLocalZ(cameraTransform->GetLocalZ() + cameraTravelDelta);
         }
@@ -1529,8 +1914,87 @@ namespace FirstPersonController
         m_crouchPrevValue = m_crouchValue;
     }
 
+    bool FirstPersonControllerComponent::CrouchingNextStep() const
+    {
+        bool crouching = m_crouching;
+
+        if(m_crouchEnableToggle && !m_crouchScriptLocked && m_crouchPrevValue == 0.f && m_crouchValue == 1.f)
+        {
+            crouching = !crouching;
+        }
+        else if(!m_crouchEnableToggle && !m_crouchScriptLocked)
+        {
+            if(m_crouchValue != 0.f
+                 && ((m_sprintValue == 0.f || !m_crouchSprintCausesStanding)
+                  || ((m_crouchPriorityWhenSprintPressed) && (m_standing || (m_crouching && !m_crouched))))
+                 && (m_jumpValue == 0.f || !m_crouchJumpCausesStanding || (m_jumpReqRepress && (m_standing || m_crouching))))
+                crouching = true;
+            else
+                crouching = false;
+        }
+
+        // If the crouch key does not take priority when the sprint key is held,
+        // and we are attempting to crouch while the sprint key is held, then do not crouch
+        if(!m_crouchPriorityWhenSprintPressed
+            && m_sprintValue != 0.f
+            && crouching
+            && m_cameraLocalZTravelDistance > -1.f * m_crouchDistance)
+           crouching = false;
+
+        return crouching;
+    }
+
+    void FirstPersonControllerComponent::ResizeCapsule(const AZ::s8& direction, const bool& transitionEnded)
+    {
+        // A reversed transition applies the height reached so far and starts counting anew
+        const bool reversed = m_capsuleResizeDirection != 0 && direction != m_capsuleResizeDirection;
+        const bool flush = transitionEnded || reversed;
+        m_capsuleResizeDirection = transitionEnded ? 0 : direction;
+
+        // Each resize rebuilds the PhysX capsule geometry, so small changes in height are coalesced
+        if(flush || abs(m_capsuleCurrentHeight - m_capsuleResizedHeight) >= m_capsuleResizeQuantum)
+        {
+            if(m_capsuleCurrentHeight != m_capsuleResizedHeight)
+            {
+                PhysX::CharacterControllerRequestBus::Event(GetEntityId(),
+                    &PhysX::CharacterControllerRequestBus::Events::Resize, m_capsuleCurrentHeight);
+                m_capsuleResizedHeight = m_capsuleCurrentHeight;
+            }
+        }
+        else
+            ++m_capsuleResizesSkipped;
+
+        if(flush)
+        {
+            m_capsuleResizesSavedLastTransition = m_capsuleResizesSkipped;
+            m_capsuleResizesSkipped = 0;
+        }
+    }
+
+    void FirstPersonControllerComponent::FlushCapsuleResize()
+    {
+        // The transition stopped partway, e.g. standing up was prevented or the character left the ground,
+        // so the capsule takes the height reached so far
+        if(m_capsuleResizeDirection != 0)
+            ResizeCapsule(m_capsuleResizeDirection, true);
+    }
+
     void FirstPersonControllerComponent::UpdateVelocityXY(const float& deltaTime)
     {
+        // While climbing, the forward and back input is handled in UpdateVelocityZ and only the left and right input
+        // moves the character across the ladder. At the bottom of the ladder the character walks off normally.
+        if(m_climbingLadder && !(m_grounded && GetLadderClimbVelocity() <= 0.f))
+        {
+            const float leftRight = m_rightValue * m_rightScale - m_leftValue * m_leftScale;
+            const AZ::Vector2 climbVelocityXY = AZ::Vector2(leftRight * m_ladderClimbSpeed * m_ladderClimbSpeedScale * m_ladderStrafeScale, 0.f);
+            m_applyVelocityXY = AZ::Vector2(AZ::Quaternion::CreateRotationZ(m_currentHeading).TransformVector(AZ::Vector3(climbVelocityXY)));
+
+            // Keep the lerp's starting point current so that leaving the ladder accelerates from the climbing velocity
+            m_prevTargetVelocityXY = m_prevApplyVelocityXY = m_instantVelocityRotation ? climbVelocityXY : m_applyVelocityXY;
+            m_lerpTime = 0.f;
+            return;
+        }
+
         float forwardBack = m_forwardValue * m_forwardScale + -1.f * m_backValue * m_backScale;
         float leftRight = -1.f * m_leftValue * m_leftScale + m_rightValue * m_rightScale;
 
@@ -1669,43 +2133,22 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::CheckGrounded(const float& deltaTime)
     {
-        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-
         // Used to determine when event notifications occur
         const bool prevGrounded = m_grounded;
         const bool prevGroundClose = m_groundClose;
 
-        AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
-
-        // Move the sphere to the location of the character and apply the Z offset
-        sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ((1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius));
-
-        AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ(-1.f);
-
-        // Adjust the pose and direction of the sphere cast based on m_sphereCastsAxisDirectionPose
-        if(m_sphereCastsAxisDirectionPose != AZ::Vector3::CreateAxisZ())
+        // The planned sweep covers the ground close distance at the full LOD tier,
+        // only the hits within the grounded distance count towards being grounded
+        AzPhysics::SceneQueryHits hits;
+        AzPhysics::SceneQueryHits closeHits;
+        for(const AzPhysics::SceneQueryHit& hit: m_groundQueryHits.m_hits)
         {
-            sphereCastDirection = -m_sphereCastsAxisDirectionPose;
-            if(m_sphereCastsAxisDirectionPose.GetZ() > 0.f)
-                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ((1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius)));
-            else
-                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ((1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius)));
+            if(m_lodTier == LodTier::Minimal || hit.m_distance <= m_groundedSphereCastOffset)
+                hits.m_hits.push_back(hit);
+            if(hit.m_distance <= m_groundCloseSphereCastOffset)
+                closeHits.m_hits.push_back(hit);
         }
 
-        AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-            (1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius,
-            sphereCastPose,
-            sphereCastDirection,
-            m_groundedSphereCastOffset,
-            AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-            m_groundedCollisionGroup,
-            nullptr);
-
-        request.m_reportMultipleHits = true;
-
-        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
-
         AZStd::vector<AzPhysics::SceneQueryHit> steepNormals;
 
         bool groundedOtherwiseGroundClose = true;
@@ -1784,23 +2227,18 @@ namespace FirstPersonController
         // Check to see if the character is close to an acceptable ground
         m_airTime += deltaTime;
 
-        request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-            (1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius,
-            sphereCastPose,
-            sphereCastDirection,
-            m_groundCloseSphereCastOffset,
-            AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-            m_groundedCollisionGroup,
-            nullptr);
-
-        request.m_reportMultipleHits = true;
+        m_groundCloseHits.clear();
 
-        groundedOtherwiseGroundClose = false;
+        // The ground close hits are skipped for controllers that are far from the active camera
+        if(m_lodTier != LodTier::Full)
+            m_groundClose = m_grounded;
+        else
+        {
+            groundedOtherwiseGroundClose = false;
 
-        hits = sceneInterface->QueryScene(sceneHandle, &request);
-        m_groundCloseHits.clear();
-        AZStd::erase_if(hits.m_hits, selfChildSlopeEntityCheck);
-        m_groundClose = hits ? true : false;
+            AZStd::erase_if(closeHits.m_hits, selfChildSlopeEntityCheck);
+            m_groundClose = closeHits ? true : false;
+        }
 
         if(m_scriptSetGroundCloseTick)
         {
@@ -1812,11 +2250,11 @@ namespace FirstPersonController
         // Trigger an event notification if the player hits the ground, is about to hit the ground,
         // or just left the ground (via jumping or otherwise)
         if(!prevGrounded && m_grounded)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnGroundHit);
+            QueueNotification(&FirstPersonControllerNotifications::OnGroundHit);
         else if(!prevGroundClose && m_groundClose)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnGroundSoonHit);
+            QueueNotification(&FirstPersonControllerNotifications::OnGroundSoonHit);
         else if(prevGrounded && !m_grounded)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnUngrounded);
+            QueueNotification(&FirstPersonControllerNotifications::OnUngrounded);
     }
 
     void FirstPersonControllerComponent::UpdateJumpMaxHoldTime()
@@ -1839,42 +2277,10 @@ namespace FirstPersonController
         }
     }
 
-    void FirstPersonControllerComponent::UpdateVelocityZ(const float& deltaTime)
+    void FirstPersonControllerComponent::UpdateHeadHit()
     {
-        // Create a shapecast sphere that will be used to detect whether there is an obstruction
-        // above the players head, and prevent them from fully standing up if there is
-        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-
-        AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
-
-        // Move the sphere to the location of the character and apply the Z offset
-        sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius));
-
-        AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ();
-
-        // Adjust the pose and direction of the sphere cast based on m_sphereCastsAxisDirectionPose
-        if(m_sphereCastsAxisDirectionPose != AZ::Vector3::CreateAxisZ())
-        {
-            sphereCastDirection = m_sphereCastsAxisDirectionPose;
-            if(m_sphereCastsAxisDirectionPose.GetZ() >= 0.f)
-                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius)));
-            else
-                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius)));
-        }
-
-        AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-            m_capsuleRadius,
-            sphereCastPose,
-            sphereCastDirection,
-            m_jumpHeadSphereCastOffset,
-            AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-            m_headCollisionGroup,
-            nullptr);
-
-        request.m_reportMultipleHits = true;
-
-        AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+        // Check for an obstruction above the player's head using the planned head sweep
+        AzPhysics::SceneQueryHits hits = m_headQueryHits;
 
         // Disregard intersections with the character's collider and its child entities,
         auto selfChildEntityCheck = [this](AzPhysics::SceneQueryHit& hit)
@@ -1919,22 +2325,289 @@ namespace FirstPersonController
         if(m_headHit)
             for(AzPhysics::SceneQueryHit hit: hits.m_hits)
                 m_headHitEntityIds.push_back(hit.m_entityId);
+    }
 
-        if(m_headHit && !m_grounded && m_applyVelocityZ >= 0.f)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnHeadHit);
+    bool FirstPersonControllerComponent::HeadSphereCastNeeded() const
+    {
+        if(m_alwaysQuerySceneCasts)
+            return true;
 
-        if(m_gravityPrevented[0] && m_gravityPrevented[1])
-        {
-            m_applyVelocityZ = m_correctedVelocityZ;
-            m_gravityPrevented[0] = false;
-            m_gravityPrevented[1] = false;
-            m_grounded = true;
-            m_groundClose = true;
-            if(m_jumpAllowedWhenGravityPrevented)
-                m_jumpHeld = false;
-        }
+        // The head hit is used to block a jump that's about to start, to stop an ascent, and for the OnHeadHit event while ascending.
+        // Grounded characters that aren't jumping, falling characters and characters climbing down have no use for it.
+        if(m_climbingLadder)
+            return GetLadderClimbVelocity() > 0.f;
+        if(m_grounded)
+            return m_jumpValue != 0.f && !m_jumpHeld;
+        return m_applyVelocityZ >= 0.f || m_launchPending || (m_doubleJumpEnabled && !m_secondJump && m_jumpValue != 0.f);
+    }
 
-        const float prevApplyVelocityZ = m_applyVelocityZ;
+    void FirstPersonControllerComponent::AttachStepping()
+    {
+        m_sceneSimulationStartHandler.Disconnect();
+        m_attachedSceneHandle = m_querySceneHandle;
+
+        // The scene queries need the scene however the controller is stepped
+        const bool sceneValid = m_attachedSceneHandle != AzPhysics::InvalidSceneHandle && m_sceneInterface != nullptr;
+        AZ_Error("First Person Controller Component", sceneValid, "Failed to retrieve the physics scene.");
+
+        // Controllers are stepped by the scheduler grouped by their scene, without it each controller steps itself
+        if(auto* stepScheduler = ControllerStepSchedulerInterface::Get())
+        {
+            AZ::TickBus::Handler::BusDisconnect();
+            stepScheduler->AddController(this, m_querySceneHandle, m_addVelocityForTimestepVsTick);
+            return;
+        }
+
+        if(!AZ::TickBus::Handler::BusIsConnected())
+            AZ::TickBus::Handler::BusConnect();
+
+        if(!m_addVelocityForTimestepVsTick || !sceneValid)
+            return;
+
+        m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                OnSceneSimulationStart(fixedDeltaTime);
+            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
+
+        m_sceneInterface->RegisterSceneSimulationStartHandler(m_attachedSceneHandle, m_sceneSimulationStartHandler);
+    }
+
+    void FirstPersonControllerComponent::ResolveQueryScene()
+    {
+        m_sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        m_querySceneHandle = AzPhysics::InvalidSceneHandle;
+
+        if(m_querySceneName.empty())
+            m_querySceneHandle = GetEntityPhysicsScene(GetEntityId());
+        else if(m_sceneInterface != nullptr)
+            m_querySceneHandle = m_sceneInterface->GetSceneHandle(m_querySceneName);
+    }
+
+    void FirstPersonControllerComponent::PlanSceneQueries()
+    {
+        m_groundQueryHits = AzPhysics::SceneQueryHits();
+        m_headQueryHits = AzPhysics::SceneQueryHits();
+        m_standQueryHits = AzPhysics::SceneQueryHits();
+
+        // Decide which of the head and stand casts can be used this step
+        m_headQueryPlanned = HeadSphereCastNeeded();
+        // Standing up is only attempted by a grounded character below its standing height once crouch is released or toggled off
+        const bool standAttempted = m_grounded && m_cameraLocalZTravelDistance != 0.f && !CrouchingNextStep();
+        m_standQueryPlanned = standAttempted && (!m_standPreventedViaScript || m_alwaysQuerySceneCasts);
+
+        if(m_headQueryPlanned)
+            ++m_sceneCastsIssuedAccum;
+        else
+            ++m_sceneCastsSkippedAccum;
+        if(standAttempted && m_standQueryPlanned)
+            ++m_sceneCastsIssuedAccum;
+        else if(standAttempted)
+            ++m_sceneCastsSkippedAccum;
+
+        if(m_sceneInterface == nullptr || m_querySceneHandle == AzPhysics::InvalidSceneHandle)
+            return;
+
+        // The character's position is read once and shared by every cast in the step
+        const AZ::Vector3 position = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
+        const AZ::Vector3 axis = m_sphereCastsAxisDirectionPose.GetNormalized();
+        const float groundSphereRadius = (1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius;
+        const AZ::Transform groundPose = AZ::Transform::CreateTranslation(position + axis*groundSphereRadius);
+        const AZ::Transform headPose = AZ::Transform::CreateTranslation(position + axis*(m_capsuleCurrentHeight - m_capsuleRadius));
+
+        // The requests are kept between steps so planning the casts doesn't allocate, only their parameters are rewritten
+        AzPhysics::SceneQueryRequests& requests = m_sceneQueryRequests;
+        requests.clear();
+
+        // The ground and ground close casts share one sweep, at the minimal LOD tier a single ray cast is used instead
+        if(m_lodTier == LodTier::Minimal)
+        {
+            if(m_groundRayCastRequest == nullptr)
+                m_groundRayCastRequest = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            m_groundRayCastRequest->m_start = groundPose.GetTranslation();
+            m_groundRayCastRequest->m_direction = -m_sphereCastsAxisDirectionPose;
+            m_groundRayCastRequest->m_distance = groundSphereRadius + m_groundedSphereCastOffset;
+            m_groundRayCastRequest->m_collisionGroup = m_groundedCollisionGroup;
+            m_groundRayCastRequest->m_reportMultipleHits = true;
+            requests.push_back(m_groundRayCastRequest);
+        }
+        else
+        {
+            const float groundDistance = (m_lodTier == LodTier::Full)
+                ? AZ::GetMax(m_groundedSphereCastOffset, m_groundCloseSphereCastOffset) : m_groundedSphereCastOffset;
+            UpdateSphereCastRequest(m_groundSphereCastRequest, groundSphereRadius, groundPose, -m_sphereCastsAxisDirectionPose,
+                groundDistance, m_groundedCollisionGroup);
+            requests.push_back(m_groundSphereCastRequest);
+        }
+
+        // The head and stand casts share one sweep when they use the same collision group
+        const bool headStandShared = m_headQueryPlanned && m_standQueryPlanned && m_headCollisionGroup == m_standCollisionGroup;
+        if(headStandShared)
+        {
+            UpdateSphereCastRequest(m_headSphereCastRequest, m_capsuleRadius, headPose, m_sphereCastsAxisDirectionPose,
+                AZ::GetMax(m_jumpHeadSphereCastOffset, m_uncrouchHeadSphereCastOffset), m_headCollisionGroup);
+            requests.push_back(m_headSphereCastRequest);
+        }
+        else
+        {
+            if(m_headQueryPlanned)
+            {
+                UpdateSphereCastRequest(m_headSphereCastRequest, m_capsuleRadius, headPose, m_sphereCastsAxisDirectionPose,
+                    m_jumpHeadSphereCastOffset, m_headCollisionGroup);
+                requests.push_back(m_headSphereCastRequest);
+            }
+            if(m_standQueryPlanned)
+            {
+                UpdateSphereCastRequest(m_standSphereCastRequest, m_capsuleRadius, headPose, m_sphereCastsAxisDirectionPose,
+                    m_uncrouchHeadSphereCastOffset, m_standCollisionGroup);
+                requests.push_back(m_standSphereCastRequest);
+            }
+        }
+
+        // Every planned cast is issued in a single scene query call, and the hits are fanned out to their consumers
+        AzPhysics::SceneQueryHitsList hitsList = m_sceneInterface->QuerySceneBatch(m_querySceneHandle, requests);
+        if(hitsList.size() != requests.size())
+            return;
+
+        size_t index = 0;
+        m_groundQueryHits = AZStd::move(hitsList[index++]);
+        if(headStandShared)
+        {
+            for(const AzPhysics::SceneQueryHit& hit: hitsList[index].m_hits)
+            {
+                if(hit.m_distance <= m_jumpHeadSphereCastOffset)
+                    m_headQueryHits.m_hits.push_back(hit);
+                if(hit.m_distance <= m_uncrouchHeadSphereCastOffset)
+                    m_standQueryHits.m_hits.push_back(hit);
+            }
+            return;
+        }
+        if(m_headQueryPlanned)
+            m_headQueryHits = AZStd::move(hitsList[index++]);
+        if(m_standQueryPlanned)
+            m_standQueryHits = AZStd::move(hitsList[index++]);
+    }
+
+    void FirstPersonControllerComponent::UpdateSphereCastRequest(AZStd::shared_ptr<AzPhysics::ShapeCastRequest>& request,
+        const float& radius, const AZ::Transform& pose, const AZ::Vector3& direction, const float& distance,
+        const AzPhysics::CollisionGroup& collisionGroup)
+    {
+        if(request == nullptr)
+        {
+            request = AZStd::make_shared<AzPhysics::ShapeCastRequest>(AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+                radius,
+                pose,
+                direction,
+                distance,
+                AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
+                collisionGroup,
+                nullptr));
+            request->m_reportMultipleHits = true;
+            return;
+        }
+
+        // The sphere shape configuration created with the request is resized rather than replaced
+        static_cast<Physics::SphereShapeConfiguration*>(request->m_shapeConfiguration.get())->m_radius = radius;
+        request->m_start = pose;
+        request->m_direction = direction;
+        request->m_distance = distance;
+        request->m_collisionGroup = collisionGroup;
+    }
+
+    void FirstPersonControllerComponent::UpdateSceneCastCounters(const float& deltaTime)
+    {
+        m_sceneCastWindowTime += deltaTime;
+        if(m_sceneCastWindowTime < 1.f)
+            return;
+
+        m_sceneCastsIssuedPerSecond = static_cast<AZ::u32>(m_sceneCastsIssuedAccum / m_sceneCastWindowTime);
+        m_sceneCastsSkippedPerSecond = static_cast<AZ::u32>(m_sceneCastsSkippedAccum / m_sceneCastWindowTime);
+        m_sceneCastsIssuedAccum = 0;
+        m_sceneCastsSkippedAccum = 0;
+        m_sceneCastWindowTime = 0.f;
+    }
+
+    void FirstPersonControllerComponent::UpdateInputEventCounters(const float& deltaTime)
+    {
+        m_inputEventWindowTime += deltaTime;
+        if(m_inputEventWindowTime < 1.f)
+            return;
+
+        m_inputEventsReceivedPerSecond = static_cast<AZ::u32>(m_inputEventsReceivedAccum / m_inputEventWindowTime);
+        m_inputEventsChangedPerSecond = static_cast<AZ::u32>(m_inputEventsChangedAccum / m_inputEventWindowTime);
+        m_inputEventsReceivedAccum = 0;
+        m_inputEventsChangedAccum = 0;
+        m_inputEventWindowTime = 0.f;
+    }
+
+    void FirstPersonControllerComponent::UpdateVelocityZ(const float& deltaTime)
+    {
+        // The head sphere cast is only planned when the result can be used in the current movement state
+        if(m_headQueryPlanned)
+            UpdateHeadHit();
+        else
+        {
+            m_headHit = false;
+            m_headHitEntityIds.clear();
+        }
+
+        if(m_headHit && !m_grounded && m_applyVelocityZ >= 0.f)
+            QueueNotification(&FirstPersonControllerNotifications::OnHeadHit);
+
+        // A launch (e.g. from an impulse pad) takes the character off the ground with the given velocity. This step's gravity is
+        // still applied below, so the Verlet average starts with a half step and the apex height doesn't depend on the frame rate.
+        if(m_launchPending)
+        {
+            m_launchPending = false;
+            StopClimbing();
+            m_grounded = false;
+            m_jumpReqRepress = true;
+            m_jumpCounter = 0.f;
+            VerticalVelocity::Launch(m_applyVelocityZ, m_applyVelocityZPrevDelta, m_launchVelocity.GetZ());
+
+            m_applyVelocityXY = AZ::Vector2(m_launchVelocity);
+            m_prevApplyVelocityXY = m_instantVelocityRotation
+                ? AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(m_applyVelocityXY)))
+                : m_applyVelocityXY;
+            m_lerpTime = 0.f;
+        }
+
+        // Gravity is suspended while climbing, the character moves along the ladder based on the input and look direction
+        if(m_climbingLadder)
+        {
+            m_applyVelocityZCurrentDelta = m_applyVelocityZPrevDelta = 0.f;
+            m_jumpCounter = 0.f;
+
+            if(m_jumpValue && !m_jumpHeld)
+            {
+                // Jump off the ladder, away from the direction the character is facing
+                m_jumpHeld = true;
+                m_applyVelocityZ = 0.f;
+                m_applyVelocityXY = AZ::Vector2(AZ::Quaternion::CreateRotationZ(m_currentHeading).TransformVector(AZ::Vector3::CreateAxisY(-m_ladderJumpOffSpeed)));
+                StopClimbing();
+                return;
+            }
+            else if(m_jumpValue == 0.f && m_jumpHeld)
+                m_jumpHeld = false;
+
+            m_applyVelocityZ = GetLadderClimbVelocity();
+            if((m_grounded && m_applyVelocityZ < 0.f) || (m_headHit && m_applyVelocityZ > 0.f))
+                m_applyVelocityZ = 0.f;
+            return;
+        }
+
+        if(m_gravityPrevented[0] && m_gravityPrevented[1])
+        {
+            m_applyVelocityZ = m_correctedVelocityZ;
+            m_gravityPrevented[0] = false;
+            m_gravityPrevented[1] = false;
+            m_grounded = true;
+            m_groundClose = true;
+            if(m_jumpAllowedWhenGravityPrevented)
+                m_jumpHeld = false;
+        }
+
+        const float prevApplyVelocityZ = m_applyVelocityZ;
 
         bool initialJump = false;
 
@@ -1952,7 +2625,7 @@ namespace FirstPersonController
                 initialJump = true;
                 m_jumpHeld = true;
                 m_jumpReqRepress = false;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnFirstJump);
+                QueueNotification(&FirstPersonControllerNotifications::OnFirstJump);
             }
             else
             {
@@ -1989,10 +2662,8 @@ namespace FirstPersonController
             if(m_jumpCounter != 0.f)
                 m_jumpCounter = 0.f;
 
-            if(m_applyVelocityZ <= 0.f)
-                m_applyVelocityZCurrentDelta = m_gravity * m_jumpFallingGravityFactor * deltaTime;
-            else
-                m_applyVelocityZCurrentDelta = m_gravity * deltaTime;
+            m_applyVelocityZCurrentDelta = VerticalVelocity::GetAirborneDelta(m_applyVelocityZ, m_gravity, m_jumpFallingGravityFactor,
+                deltaTime);
 
             if(!m_doubleJumpEnabled && !m_jumpHeld)
                 m_jumpHeld = true;
@@ -2011,17 +2682,14 @@ namespace FirstPersonController
                 m_applyVelocityZCurrentDelta = 0.f;
                 m_secondJump = true;
                 m_jumpHeld = true;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnSecondJump);
+                QueueNotification(&FirstPersonControllerNotifications::OnSecondJump);
             }
         }
 
         // Perform an average of the current and previous Z velocity delta
         // as described by Verlet integration, which should reduce accumulated error
         if(!initialJump)
-        {
-            m_applyVelocityZ += (m_applyVelocityZCurrentDelta + m_applyVelocityZPrevDelta) / 2.f;
-            m_applyVelocityZPrevDelta = m_applyVelocityZCurrentDelta;
-        }
+            VerticalVelocity::Integrate(m_applyVelocityZ, m_applyVelocityZPrevDelta, m_applyVelocityZCurrentDelta);
         else
             m_applyVelocityZ += m_applyVelocityZCurrentDelta;
 
@@ -2049,7 +2717,7 @@ namespace FirstPersonController
         }
 
         if(prevApplyVelocityZ >= 0.f && m_applyVelocityZ < 0.f)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStartedFalling);
+            QueueNotification(&FirstPersonControllerNotifications::OnStartedFalling);
 
         // Debug print statements to observe the jump mechanic
         //AZ::Vector3 pos = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
@@ -2136,9 +2804,33 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::ProcessInput(const float& deltaTime, const bool& timestepElseTick)
     {
+        float stepDeltaTime = deltaTime;
+        if(BeginStep(stepDeltaTime, timestepElseTick))
+        {
+            PlanSceneQueries();
+            FinishStep(stepDeltaTime);
+        }
+
+        EndStep();
+    }
+
+    bool FirstPersonControllerComponent::BeginStep(float& stepDeltaTime, const bool& timestepElseTick)
+    {
+        const float deltaTime = stepDeltaTime;
+        m_queuedNotifications.Defer();
+
+        // Gamepad input is processed per tick, ahead of the input overrides which may replace it
+        if(!timestepElseTick)
+            ProcessGamepadInput(deltaTime);
+        ApplyInputOverrides(timestepElseTick);
+
         // Only update the rotation on each tick
         if(!timestepElseTick)
         {
+            UpdateLodTier();
+            UpdateSceneCastCounters(deltaTime);
+            UpdateInputEventCounters(deltaTime);
+
             UpdateRotation(deltaTime);
 
             // Get the current velocity to determine if something was hit
@@ -2167,7 +2859,7 @@ namespace FirstPersonController
                     if(m_gravityPrevented[0])
                     {
                         m_gravityPrevented[1] = true;
-                        FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnGravityPrevented);
+                        QueueNotification(&FirstPersonControllerNotifications::OnGravityPrevented);
                     }
                     else
                         m_gravityPrevented[0] = true;
@@ -2175,7 +2867,7 @@ namespace FirstPersonController
                 else
                     m_gravityPrevented[0] = m_gravityPrevented[1] = false;
 
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnHitSomething);
+                QueueNotification(&FirstPersonControllerNotifications::OnHitSomething);
             }
             else
                 m_hitSomething = false;
@@ -2183,48 +2875,273 @@ namespace FirstPersonController
 
         m_prevPrevTargetVelocity = m_prevTargetVelocity;
 
-        if(!m_addVelocityForTimestepVsTick || timestepElseTick)
+        if(m_addVelocityForTimestepVsTick && !timestepElseTick)
+            return false;
+
+        // Controllers at a lower LOD tier only step once every few ticks (or timesteps),
+        // the last target velocity is applied again in between the steps
+        if(!LodStepDue(stepDeltaTime))
         {
-            CheckGrounded(deltaTime);
+            SubmitTargetVelocity();
+            return false;
+        }
 
-            if(m_grounded)
-                CrouchManager(deltaTime);
-
-            // So long as the character is grounded or depending on how the update X&Y velocity while jumping
-            // boolean values are set, and based on the state of jumping/falling, update the X&Y velocity accordingly
-            if(m_grounded || (m_updateXYAscending && m_updateXYDecending && !m_updateXYOnlyNearGround)
-               || ((m_updateXYAscending && m_applyVelocityZ >= 0.f) && (!m_updateXYOnlyNearGround || m_groundClose))
-               || ((m_updateXYDecending && m_applyVelocityZ <= 0.f) && (!m_updateXYOnlyNearGround || m_groundClose)) )
-                UpdateVelocityXY(deltaTime);
-
-            UpdateVelocityZ(deltaTime);
-
-            // Track the sum of the normal vectors for the velocity's XY plane if its set
-            if(m_velocityXCrossYTracksNormal)
-                SetVelocityXCrossYDirection(GetGroundSumNormalsDirection());
-
-            AZ::Vector3 addVelocityHeading = m_addVelocityHeading;
-            // Rotate addVelocityHeading so it's with respect to the character's heading
-            if(!addVelocityHeading.IsZero())
-                addVelocityHeading = AZ::Quaternion::CreateRotationZ(m_currentHeading).TransformVector(m_addVelocityHeading);
-            // Tilt the XY velocity plane based on m_velocityXCrossYDirection
-            m_prevTargetVelocity = TiltVectorXCrossY((m_applyVelocityXY + AZ::Vector2(m_addVelocityWorld) + AZ::Vector2(addVelocityHeading)), m_velocityXCrossYDirection);
-            // Change the +Z direction based on m_velocityZPosDirection
-            m_prevTargetVelocity += (m_applyVelocityZ + m_addVelocityWorld.GetZ() + m_addVelocityHeading.GetZ()) * m_velocityZPosDirection;
-
-            // Placed here for when CharacterControllerComponent::SetUpDirection() is implemented
-            /* Physics::CharacterRequestBus::Event(GetEntityId(),
-                  &Physics::CharacterRequestBus::Events::SetUpDirection, m_sphereCastsAxisDirectionPose); */
-
-            if(!m_addVelocityForTimestepVsTick)
-                Physics::CharacterRequestBus::Event(GetEntityId(),
-                    &Physics::CharacterRequestBus::Events::AddVelocityForTick,
-                    m_prevTargetVelocity);
-            else
-                Physics::CharacterRequestBus::Event(GetEntityId(),
-                    &Physics::CharacterRequestBus::Events::AddVelocityForPhysicsTimestep,
-                    m_prevTargetVelocity);
+        return true;
+    }
+
+    void FirstPersonControllerComponent::FinishStep(const float& stepDeltaTime)
+    {
+        CheckGrounded(stepDeltaTime);
+
+        UpdatePlatformVelocity(stepDeltaTime);
+
+        if(m_grounded)
+            CrouchManager(stepDeltaTime);
+        else
+            FlushCapsuleResize();
+
+        // So long as the character is grounded or depending on how the update X&Y velocity while jumping
+        // boolean values are set, and based on the state of jumping/falling, update the X&Y velocity accordingly
+        if(m_grounded || m_climbingLadder || (m_updateXYAscending && m_updateXYDecending && !m_updateXYOnlyNearGround)
+           || ((m_updateXYAscending && m_applyVelocityZ >= 0.f) && (!m_updateXYOnlyNearGround || m_groundClose))
+           || ((m_updateXYDecending && m_applyVelocityZ <= 0.f) && (!m_updateXYOnlyNearGround || m_groundClose)) )
+            UpdateVelocityXY(stepDeltaTime);
+
+        UpdateVelocityZ(stepDeltaTime);
+
+        // Track the sum of the normal vectors for the velocity's XY plane if its set
+        if(m_velocityXCrossYTracksNormal)
+            SetVelocityXCrossYDirection(GetGroundSumNormalsDirection());
+
+        AZ::Vector3 addVelocityHeading = m_addVelocityHeading;
+        // Rotate addVelocityHeading so it's with respect to the character's heading
+        if(!addVelocityHeading.IsZero())
+            addVelocityHeading = AZ::Quaternion::CreateRotationZ(m_currentHeading).TransformVector(m_addVelocityHeading);
+        // Tilt the XY velocity plane based on m_velocityXCrossYDirection
+        m_prevTargetVelocity = TiltVectorXCrossY((m_applyVelocityXY + AZ::Vector2(m_addVelocityWorld) + AZ::Vector2(addVelocityHeading)), m_velocityXCrossYDirection);
+        // Change the +Z direction based on m_velocityZPosDirection
+        m_prevTargetVelocity += (m_applyVelocityZ + m_addVelocityWorld.GetZ() + m_addVelocityHeading.GetZ()) * m_velocityZPosDirection;
+        // Ride along with the ground entity
+        m_prevTargetVelocity += m_platformVelocity;
+
+        // Placed here for when CharacterControllerComponent::SetUpDirection() is implemented
+        /* Physics::CharacterRequestBus::Event(GetEntityId(),
+              &Physics::CharacterRequestBus::Events::SetUpDirection, m_sphereCastsAxisDirectionPose); */
+
+        SubmitTargetVelocity();
+    }
+
+    void FirstPersonControllerComponent::SubmitTargetVelocity()
+    {
+        if(!m_addVelocityForTimestepVsTick)
+            Physics::CharacterRequestBus::Event(GetEntityId(),
+                &Physics::CharacterRequestBus::Events::AddVelocityForTick,
+                m_prevTargetVelocity);
+        else
+            Physics::CharacterRequestBus::Event(GetEntityId(),
+                &Physics::CharacterRequestBus::Events::AddVelocityForPhysicsTimestep,
+                m_prevTargetVelocity);
+    }
+
+    void FirstPersonControllerComponent::UpdatePlatformVelocity(const float& deltaTime)
+    {
+        if(!m_inheritPlatformVelocity || !m_grounded || m_groundHits.empty())
+        {
+            m_platformVelocity = AZ::Vector3::CreateZero();
+            m_platformEntityId = AZ::EntityId();
+            m_platformTracker.Reset();
+            return;
+        }
+
+        // The closest ground hit is taken as the platform
+        const AzPhysics::SceneQueryHit* platformHit = &m_groundHits.front();
+        for(const AzPhysics::SceneQueryHit& hit : m_groundHits)
+            if(hit.m_distance < platformHit->m_distance)
+                platformHit = &hit;
+        m_platformEntityId = platformHit->m_entityId;
+
+        // A character parented to the platform is already carried by the transform hierarchy
+        if(GetEntity()->GetTransform()->GetParentId() == m_platformEntityId)
+        {
+            m_platformVelocity = AZ::Vector3::CreateZero();
+            m_platformTracker.Reset();
+            return;
+        }
+
+        const AZ::Vector3 characterPosition = GetEntity()->GetTransform()->GetWorldTranslation();
+        AZ::Transform platformTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(platformTM, m_platformEntityId, &AZ::TransformBus::Events::GetWorldTM);
+
+        AzPhysics::RigidBody* platformBody = nullptr;
+        Physics::RigidBodyRequestBus::EventResult(platformBody, m_platformEntityId, &Physics::RigidBodyRequests::GetRigidBody);
+
+        PlatformBodyVelocity bodyVelocity;
+        if(platformBody != nullptr)
+        {
+            bodyVelocity.m_linearVelocity = platformBody->GetLinearVelocity();
+            bodyVelocity.m_angularVelocity = platformBody->GetAngularVelocity();
+            bodyVelocity.m_centerOfMass = platformBody->GetCenterOfMassWorld();
+        }
+
+        float yawDelta = 0.f;
+        m_platformVelocity = m_platformTracker.Step(m_platformEntityId, platformTM, bodyVelocity, characterPosition, deltaTime, yawDelta);
+
+        if(m_platformRotationTurnsCharacter && yawDelta != 0.f)
+            GetEntity()->GetTransform()->RotateAroundLocalZ(yawDelta);
+    }
+
+    float FirstPersonControllerComponent::GetLadderClimbVelocity() const
+    {
+        const float forwardBack = m_forwardValue * m_forwardScale - m_backValue * m_backScale;
+
+        // Looking down past the threshold reverses the direction, as with Half-Life 2's ladders
+        const float lookDirection = (m_currentPitch >= -AZ::DegToRad(m_ladderLookDownAngle)) ? 1.f : -1.f;
+
+        return forwardBack * lookDirection * m_ladderClimbSpeed * m_ladderClimbSpeedScale;
+    }
+
+    void FirstPersonControllerComponent::StopClimbing()
+    {
+        if(!m_climbingLadder)
+            return;
+
+        m_climbingLadder = false;
+
+        // Stopping inside the volume, e.g. by jumping off, hands the character back to the ladder so it can be grabbed again
+        if(m_ladderEntityId.IsValid())
+        {
+            const AZ::EntityId ladderEntityId = m_ladderEntityId;
+            m_ladderEntityId = AZ::EntityId();
+            LadderComponentRequestBus::Event(ladderEntityId, &LadderComponentRequestBus::Events::ReleaseClimber, GetEntityId());
         }
+
+        QueueNotification(&FirstPersonControllerNotifications::OnStoppedClimbing);
+    }
+
+    void FirstPersonControllerComponent::QueueNotification(NotificationEvent notification)
+    {
+        // Outside of a step, e.g. when a ladder is entered, the notification is sent right away
+        m_queuedNotifications.Push(notification, [this](NotificationEvent event)
+            {
+                DispatchNotification(event);
+            });
+    }
+
+    void FirstPersonControllerComponent::DispatchNotification(NotificationEvent notification)
+    {
+        if(m_broadcastNotifications)
+            FirstPersonControllerNotificationBus::Broadcast(notification);
+        else
+            FirstPersonControllerNotificationBus::Event(GetEntityId(), notification);
+    }
+
+    void FirstPersonControllerComponent::EndStep()
+    {
+        RestoreOverriddenInput();
+        FlushNotifications();
+    }
+
+    void FirstPersonControllerComponent::FlushNotifications()
+    {
+        // Handlers may call back into the controller, the notifications they raise are sent right away
+        m_queuedNotifications.Flush([this](NotificationEvent event)
+            {
+                DispatchNotification(event);
+            });
+    }
+
+    AZStd::array<float*, InputOverrideChannelCount> FirstPersonControllerComponent::GetInputChannelValuePointers()
+    {
+        return { &m_forwardValue, &m_backValue, &m_leftValue, &m_rightValue, &m_yawValue, &m_pitchValue,
+            &m_sprintValue, &m_crouchValue, &m_jumpValue };
+    }
+
+    void FirstPersonControllerComponent::ApplyInputOverrides(const bool& timestepElseTick)
+    {
+        const bool stepInputHandled = ControllerStepInputNotificationBus::HasHandlers(GetEntityId());
+        const bool gamepadMoving = !m_gamepadMove.IsZero();
+        if(m_inputOverrides.IsEmpty() && !stepInputHandled && !gamepadMoving)
+            return;
+
+        const AZStd::array<float*, InputOverrideChannelCount> channelValues = GetInputChannelValuePointers();
+        for(AZ::u32 channel = 0; channel < InputOverrideChannelCount; ++channel)
+            m_rawInputValues[channel] = *channelValues[channel];
+
+        InputChannelValues values = m_rawInputValues;
+        m_overriddenInputMask = 0;
+        // The gamepad's movement is combined with the keyboard's, the greater of the two is used in each direction
+        if(gamepadMoving)
+        {
+            GamepadInputProcessor::CombineMoveInput(m_gamepadMove, values[0], values[1], values[2], values[3]);
+            m_overriddenInputMask = static_cast<AZ::u32>(InputOverrideChannel::Forward) | static_cast<AZ::u32>(InputOverrideChannel::Back)
+                | static_cast<AZ::u32>(InputOverrideChannel::Left) | static_cast<AZ::u32>(InputOverrideChannel::Right);
+        }
+        m_overriddenInputMask |= m_inputOverrides.Apply(values);
+        // The step input handlers, e.g. the network component, get the final say and may replace any channel
+        if(stepInputHandled)
+        {
+            ControllerStepInputNotificationBus::Event(GetEntityId(),
+                &ControllerStepInputNotifications::OnStepInput, values, timestepElseTick);
+            m_overriddenInputMask = InputOverrideAllChannels;
+        }
+        for(AZ::u32 channel = 0; channel < InputOverrideChannelCount; ++channel)
+            *channelValues[channel] = values[channel];
+        m_appliedInputValues = values;
+
+        // Lifetimes are counted in ticks, also for the controllers that step per physics timestep
+        if(!timestepElseTick)
+            m_inputOverrides.Tick();
+    }
+
+    void FirstPersonControllerComponent::RestoreOverriddenInput()
+    {
+        if(m_overriddenInputMask == 0)
+            return;
+
+        // Input events received during the step wrote the newer value over the applied one, so those channels are kept
+        const AZStd::array<float*, InputOverrideChannelCount> channelValues = GetInputChannelValuePointers();
+        InputChannelValues values;
+        for(AZ::u32 channel = 0; channel < InputOverrideChannelCount; ++channel)
+            values[channel] = *channelValues[channel];
+        InputOverrideStack::Restore(values, m_rawInputValues, m_appliedInputValues, m_overriddenInputMask);
+        for(AZ::u32 channel = 0; channel < InputOverrideChannelCount; ++channel)
+            *channelValues[channel] = values[channel];
+        m_overriddenInputMask = 0;
+    }
+
+    void FirstPersonControllerComponent::UpdateLodTier()
+    {
+        // The active camera is looked up once per tick here, ahead of UpdateRotation() which also uses it,
+        // so that the tier is chosen against the camera that is active on this tick
+        m_activeCameraEntity = GetActiveCameraEntityPtr();
+
+        // Controllers without LOD stay at the full tier and aren't counted in the LOD statistics
+        if(!m_lodEnabled)
+            return;
+
+        if(m_activeCameraEntity == nullptr)
+            m_lodTier = LodTier::Full;
+        else
+            m_lodTier = ControllerLod::SelectTier(GetEntity()->GetTransform()->GetWorldTranslation().GetDistanceSq(
+                m_activeCameraEntity->GetTransform()->GetWorldTranslation()), m_lodReducedDistance, m_lodMinimalDistance);
+
+        if(auto* firstPersonControllerInterface = FirstPersonControllerInterface::Get())
+            firstPersonControllerInterface->ReportLodTier(m_lodTier);
+    }
+
+    bool FirstPersonControllerComponent::LodStepDue(float& stepDeltaTime)
+    {
+        if(!m_lodEnabled)
+            return true;
+
+        const AZ::u32 stepInterval = ControllerLod::GetStepInterval(m_lodTier, m_lodReducedStepInterval, m_lodMinimalStepInterval);
+        if(!ControllerLod::StepDue(m_lodSkippedSteps, m_lodAccumulatedDeltaTime, stepDeltaTime, stepInterval))
+            return false;
+
+        if(auto* firstPersonControllerInterface = FirstPersonControllerInterface::Get())
+            firstPersonControllerInterface->ReportLodStep(m_lodTier);
+
+        return true;
     }
 
     // Event Notification methods for use in scripts
@@ -2252,6 +3169,8 @@ namespace FirstPersonController
     void FirstPersonControllerComponent::OnSprintStarted(){}
     void FirstPersonControllerComponent::OnCooldownStarted(){}
     void FirstPersonControllerComponent::OnCooldownDone(){}
+    void FirstPersonControllerComponent::OnStartedClimbing(){}
+    void FirstPersonControllerComponent::OnStoppedClimbing(){}
 
     // Request Bus getter and setter methods for use in scripts
     AZ::EntityId FirstPersonControllerComponent::GetActiveCameraEntityId() const
@@ -2268,11 +3187,16 @@ namespace FirstPersonController
             &PhysX::CharacterControllerRequestBus::Events::GetHeight);
         PhysX::CharacterControllerRequestBus::EventResult(m_capsuleRadius, GetEntityId(),
             &PhysX::CharacterControllerRequestBus::Events::GetRadius);
+        Physics::CharacterRequestBus::EventResult(m_stepHeight, GetEntityId(),
+            &Physics::CharacterRequestBus::Events::GetStepHeight);
 
         if(m_crouchDistance > m_capsuleHeight - 2.f*m_capsuleRadius)
             m_crouchDistance = m_capsuleHeight - 2.f*m_capsuleRadius;
 
         m_capsuleCurrentHeight = m_capsuleHeight;
+        m_capsuleResizedHeight = m_capsuleHeight;
+        m_capsuleResizeDirection = 0;
+        m_capsuleResizesSkipped = 0;
     }
     void FirstPersonControllerComponent::ReacquireMaxSlopeAngle()
     {
@@ -2707,34 +3631,7 @@ namespace FirstPersonController
     void FirstPersonControllerComponent::SetAddVelocityForTimestepVsTick(const bool& new_addVelocityForTimestepVsTick)
     {
         m_addVelocityForTimestepVsTick = new_addVelocityForTimestepVsTick;
-
-        if(m_addVelocityForTimestepVsTick)
-        {
-            Physics::DefaultWorldBus::BroadcastResult(m_attachedSceneHandle, &Physics::DefaultWorldRequests::GetDefaultSceneHandle);
-            if(m_attachedSceneHandle == AzPhysics::InvalidSceneHandle)
-            {
-                AZ_Error("First Person Controller Component", false, "Failed to retrieve default scene.");
-                return;
-            }
-
-            m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
-                [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
-                {
-                    OnSceneSimulationStart(fixedDeltaTime);
-                }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
-
-            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-
-            if(sceneInterface != nullptr)
-            {
-                sceneInterface->RegisterSceneSimulationStartHandler(m_attachedSceneHandle, m_sceneSimulationStartHandler);
-            }
-        }
-        else
-        {
-            m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
-            m_sceneSimulationStartHandler.Disconnect();
-        }
+        AttachStepping();
     }
     float FirstPersonControllerComponent::GetPhysicsTimestepScaleFactor() const
     {
@@ -3519,4 +4416,426 @@ namespace FirstPersonController
     {
         return m_currentPitch;
     }
+    bool FirstPersonControllerComponent::GetLodEnabled() const
+    {
+        return m_lodEnabled;
+    }
+    void FirstPersonControllerComponent::SetLodEnabled(const bool& new_lodEnabled)
+    {
+        m_lodEnabled = new_lodEnabled;
+        if(!m_lodEnabled)
+        {
+            m_lodTier = LodTier::Full;
+            m_lodSkippedSteps = 0;
+            m_lodAccumulatedDeltaTime = 0.f;
+        }
+    }
+    float FirstPersonControllerComponent::GetLodReducedDistance() const
+    {
+        return m_lodReducedDistance;
+    }
+    void FirstPersonControllerComponent::SetLodReducedDistance(const float& new_lodReducedDistance)
+    {
+        m_lodReducedDistance = new_lodReducedDistance;
+    }
+    float FirstPersonControllerComponent::GetLodMinimalDistance() const
+    {
+        return m_lodMinimalDistance;
+    }
+    void FirstPersonControllerComponent::SetLodMinimalDistance(const float& new_lodMinimalDistance)
+    {
+        m_lodMinimalDistance = new_lodMinimalDistance;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetLodReducedStepInterval() const
+    {
+        return m_lodReducedStepInterval;
+    }
+    void FirstPersonControllerComponent::SetLodReducedStepInterval(const AZ::u32& new_lodReducedStepInterval)
+    {
+        m_lodReducedStepInterval = AZ::GetMax(new_lodReducedStepInterval, 1u);
+    }
+    AZ::u32 FirstPersonControllerComponent::GetLodMinimalStepInterval() const
+    {
+        return m_lodMinimalStepInterval;
+    }
+    void FirstPersonControllerComponent::SetLodMinimalStepInterval(const AZ::u32& new_lodMinimalStepInterval)
+    {
+        m_lodMinimalStepInterval = AZ::GetMax(new_lodMinimalStepInterval, 1u);
+    }
+    AZ::u8 FirstPersonControllerComponent::GetLodTier() const
+    {
+        return static_cast<AZ::u8>(m_lodTier);
+    }
+    float FirstPersonControllerComponent::GetCapsuleResizeQuantum() const
+    {
+        return m_capsuleResizeQuantum;
+    }
+    void FirstPersonControllerComponent::SetCapsuleResizeQuantum(const float& new_capsuleResizeQuantum)
+    {
+        m_capsuleResizeQuantum = AZ::GetMax(new_capsuleResizeQuantum, 0.f);
+    }
+    AZ::u32 FirstPersonControllerComponent::GetCapsuleResizesSavedLastTransition() const
+    {
+        return m_capsuleResizesSavedLastTransition;
+    }
+    bool FirstPersonControllerComponent::GetLookInputRedirected() const
+    {
+        return m_lookInputRedirected;
+    }
+    void FirstPersonControllerComponent::SetLookInputRedirected(const bool& new_lookInputRedirected)
+    {
+        m_lookInputRedirected = new_lookInputRedirected;
+    }
+    AZ::Vector2 FirstPersonControllerComponent::GetGamepadLookDelta() const
+    {
+        return m_gamepadLookDelta;
+    }
+    bool FirstPersonControllerComponent::GetInheritPlatformVelocity() const
+    {
+        return m_inheritPlatformVelocity;
+    }
+    void FirstPersonControllerComponent::SetInheritPlatformVelocity(const bool& new_inheritPlatformVelocity)
+    {
+        m_inheritPlatformVelocity = new_inheritPlatformVelocity;
+        if(!m_inheritPlatformVelocity)
+        {
+            m_platformVelocity = AZ::Vector3::CreateZero();
+            m_platformEntityId = AZ::EntityId();
+            m_platformTracker.Reset();
+        }
+    }
+    bool FirstPersonControllerComponent::GetPlatformRotationTurnsCharacter() const
+    {
+        return m_platformRotationTurnsCharacter;
+    }
+    void FirstPersonControllerComponent::SetPlatformRotationTurnsCharacter(const bool& new_platformRotationTurnsCharacter)
+    {
+        m_platformRotationTurnsCharacter = new_platformRotationTurnsCharacter;
+    }
+    AZ::EntityId FirstPersonControllerComponent::GetPlatformEntityId() const
+    {
+        return m_platformEntityId;
+    }
+    AZ::Vector3 FirstPersonControllerComponent::GetPlatformVelocity() const
+    {
+        return m_platformVelocity;
+    }
+    void FirstPersonControllerComponent::EnterLadder(const AZ::EntityId& ladderEntityId)
+    {
+        if(!m_ladderClimbingEnabled)
+            return;
+
+        // After jumping off or being launched the ladder isn't grabbed until the jump is released and the character stops rising
+        if(!m_climbingLadder && (m_jumpValue != 0.f || (!m_grounded && m_applyVelocityZ > 0.f)))
+            return;
+
+        m_ladderEntityId = ladderEntityId;
+        m_ladderClimbSpeedScale = 1.f;
+        LadderComponentRequestBus::EventResult(m_ladderClimbSpeedScale, m_ladderEntityId, &LadderComponentRequestBus::Events::GetClimbSpeedScale);
+
+        if(!m_climbingLadder)
+        {
+            m_climbingLadder = true;
+            m_applyVelocityZ = 0.f;
+            QueueNotification(&FirstPersonControllerNotifications::OnStartedClimbing);
+        }
+    }
+    void FirstPersonControllerComponent::ExitLadder(const AZ::EntityId& ladderEntityId)
+    {
+        if(ladderEntityId != m_ladderEntityId)
+            return;
+
+        m_ladderEntityId = AZ::EntityId();
+
+        // Leaving through the top of the ladder carries the character forward onto the ledge
+        if(m_climbingLadder && m_applyVelocityZ > 0.f)
+            m_applyVelocityXY = AZ::Vector2(AZ::Quaternion::CreateRotationZ(m_currentHeading).TransformVector(
+                AZ::Vector3::CreateAxisY(m_ladderClimbSpeed * m_ladderClimbSpeedScale)));
+
+        StopClimbing();
+    }
+    bool FirstPersonControllerComponent::GetClimbingLadder() const
+    {
+        return m_climbingLadder;
+    }
+    AZ::EntityId FirstPersonControllerComponent::GetLadderEntityId() const
+    {
+        return m_ladderEntityId;
+    }
+    bool FirstPersonControllerComponent::GetLadderClimbingEnabled() const
+    {
+        return m_ladderClimbingEnabled;
+    }
+    void FirstPersonControllerComponent::SetLadderClimbingEnabled(const bool& new_ladderClimbingEnabled)
+    {
+        m_ladderClimbingEnabled = new_ladderClimbingEnabled;
+        if(!m_ladderClimbingEnabled)
+            StopClimbing();
+    }
+    float FirstPersonControllerComponent::GetLadderClimbSpeed() const
+    {
+        return m_ladderClimbSpeed;
+    }
+    void FirstPersonControllerComponent::SetLadderClimbSpeed(const float& new_ladderClimbSpeed)
+    {
+        m_ladderClimbSpeed = new_ladderClimbSpeed;
+    }
+    float FirstPersonControllerComponent::GetLadderStrafeScale() const
+    {
+        return m_ladderStrafeScale;
+    }
+    void FirstPersonControllerComponent::SetLadderStrafeScale(const float& new_ladderStrafeScale)
+    {
+        m_ladderStrafeScale = new_ladderStrafeScale;
+    }
+    float FirstPersonControllerComponent::GetLadderLookDownAngle() const
+    {
+        return m_ladderLookDownAngle;
+    }
+    void FirstPersonControllerComponent::SetLadderLookDownAngle(const float& new_ladderLookDownAngle)
+    {
+        m_ladderLookDownAngle = new_ladderLookDownAngle;
+    }
+    float FirstPersonControllerComponent::GetLadderJumpOffSpeed() const
+    {
+        return m_ladderJumpOffSpeed;
+    }
+    void FirstPersonControllerComponent::SetLadderJumpOffSpeed(const float& new_ladderJumpOffSpeed)
+    {
+        m_ladderJumpOffSpeed = new_ladderJumpOffSpeed;
+    }
+    bool FirstPersonControllerComponent::Teleport(const AZ::Vector3& position)
+    {
+        // The character's own position is validated like any other teleport so that it never lands inside geometry
+        if(auto* characterTeleport = CharacterTeleportInterface::Get())
+            return characterTeleport->Teleport(GetEntityId(), position);
+
+        AZ_Warning("First Person Controller Component", false, "No character teleport service is available, the teleport was skipped.");
+        return false;
+    }
+    void FirstPersonControllerComponent::ResetVelocity()
+    {
+        m_applyVelocityXY = m_prevApplyVelocityXY = m_prevTargetVelocityXY = m_correctedVelocityXY = AZ::Vector2::CreateZero();
+        m_applyVelocityZ = m_applyVelocityZCurrentDelta = m_applyVelocityZPrevDelta = m_correctedVelocityZ = 0.f;
+        m_prevTargetVelocity = AZ::Vector3::CreateZero();
+        m_lerpTime = 0.f;
+
+        // The platform the character stood on is no longer underneath it
+        m_platformVelocity = AZ::Vector3::CreateZero();
+        m_platformEntityId = AZ::EntityId();
+        m_platformTracker.Reset();
+
+        StopClimbing();
+    }
+    void FirstPersonControllerComponent::Launch(const AZ::Vector3& velocity)
+    {
+        m_launchVelocity = velocity;
+        m_launchPending = true;
+    }
+    bool FirstPersonControllerComponent::GetAlwaysQuerySceneCasts() const
+    {
+        return m_alwaysQuerySceneCasts;
+    }
+    void FirstPersonControllerComponent::SetAlwaysQuerySceneCasts(const bool& new_alwaysQuerySceneCasts)
+    {
+        m_alwaysQuerySceneCasts = new_alwaysQuerySceneCasts;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetIssuedSceneCastsPerSecond() const
+    {
+        return m_sceneCastsIssuedPerSecond;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetSkippedSceneCastsPerSecond() const
+    {
+        return m_sceneCastsSkippedPerSecond;
+    }
+    AZStd::string FirstPersonControllerComponent::GetQuerySceneName() const
+    {
+        return m_querySceneName;
+    }
+    void FirstPersonControllerComponent::SetQuerySceneName(const AZStd::string& new_querySceneName)
+    {
+        m_querySceneName = new_querySceneName;
+        ResolveQueryScene();
+        AttachStepping();
+    }
+    bool FirstPersonControllerComponent::GetBroadcastNotifications() const
+    {
+        return m_broadcastNotifications;
+    }
+    void FirstPersonControllerComponent::SetBroadcastNotifications(const bool& new_broadcastNotifications)
+    {
+        m_broadcastNotifications = new_broadcastNotifications;
+    }
+    FirstPersonControllerState FirstPersonControllerComponent::GetStateSnapshot() const
+    {
+        FirstPersonControllerState state;
+        state.m_forwardValue = m_forwardValue;
+        state.m_backValue = m_backValue;
+        state.m_leftValue = m_leftValue;
+        state.m_rightValue = m_rightValue;
+        state.m_yawValue = m_yawValue;
+        state.m_pitchValue = m_pitchValue;
+        state.m_sprintValue = m_sprintValue;
+        state.m_crouchValue = m_crouchValue;
+        state.m_jumpValue = m_jumpValue;
+
+        state.m_forwardScale = m_forwardScale;
+        state.m_backScale = m_backScale;
+        state.m_leftScale = m_leftScale;
+        state.m_rightScale = m_rightScale;
+        state.m_yawSensitivity = m_yawSensitivity;
+        state.m_pitchSensitivity = m_pitchSensitivity;
+
+        state.m_topWalkSpeed = m_speed;
+        state.m_gravity = m_gravity;
+        state.m_jumpInitialVelocity = m_jumpInitialVelocity;
+        state.m_applyVelocityXY = m_applyVelocityXY;
+        state.m_applyVelocityZ = m_applyVelocityZ;
+        state.m_addVelocityWorld = m_addVelocityWorld;
+        state.m_addVelocityHeading = m_addVelocityHeading;
+
+        state.m_grounded = m_grounded;
+        state.m_groundClose = m_groundClose;
+        state.m_airTime = m_airTime;
+        state.m_heading = m_currentHeading;
+        state.m_pitch = m_currentPitch;
+        state.m_crouched = m_crouched;
+        state.m_sprinting = GetSprinting();
+        state.m_staminaPercentage = m_staminaPercentage;
+        state.m_climbingLadder = m_climbingLadder;
+        return state;
+    }
+    void FirstPersonControllerComponent::ApplyStateOverrides(const FirstPersonControllerState& new_state)
+    {
+        m_forwardValue = new_state.m_forwardValue;
+        m_backValue = new_state.m_backValue;
+        m_leftValue = new_state.m_leftValue;
+        m_rightValue = new_state.m_rightValue;
+        m_yawValue = new_state.m_yawValue;
+        m_pitchValue = new_state.m_pitchValue;
+        m_sprintValue = new_state.m_sprintValue;
+        m_crouchValue = new_state.m_crouchValue;
+        m_jumpValue = new_state.m_jumpValue;
+
+        m_forwardScale = new_state.m_forwardScale;
+        m_backScale = new_state.m_backScale;
+        m_leftScale = new_state.m_leftScale;
+        m_rightScale = new_state.m_rightScale;
+        m_yawSensitivity = new_state.m_yawSensitivity;
+        m_pitchSensitivity = new_state.m_pitchSensitivity;
+
+        m_speed = new_state.m_topWalkSpeed;
+        m_addVelocityWorld = new_state.m_addVelocityWorld;
+        m_addVelocityHeading = new_state.m_addVelocityHeading;
+
+        // The setters with side effects are only used for the values that were changed, so that applying
+        // an unmodified snapshot doesn't unground the character or reset the velocity rotation
+        if(new_state.m_gravity != m_gravity)
+            SetGravity(new_state.m_gravity);
+        if(new_state.m_jumpInitialVelocity != m_jumpInitialVelocity)
+            SetJumpInitialVelocity(new_state.m_jumpInitialVelocity);
+        if(new_state.m_applyVelocityXY != m_applyVelocityXY)
+            SetApplyVelocityXY(new_state.m_applyVelocityXY);
+        if(new_state.m_applyVelocityZ != m_applyVelocityZ)
+            SetApplyVelocityZ(new_state.m_applyVelocityZ);
+    }
+    AZ::u32 FirstPersonControllerComponent::PushInputOverride(const InputOverride& inputOverride)
+    {
+        return m_inputOverrides.Push(inputOverride);
+    }
+    bool FirstPersonControllerComponent::PopInputOverride(const AZ::u32& handle)
+    {
+        return m_inputOverrides.Pop(handle);
+    }
+    void FirstPersonControllerComponent::ClearInputOverrides()
+    {
+        m_inputOverrides.Clear();
+    }
+    AZ::u32 FirstPersonControllerComponent::GetInputOverrideCount() const
+    {
+        return m_inputOverrides.GetCount();
+    }
+    bool FirstPersonControllerComponent::GetGamepadEnabled() const
+    {
+        return m_gamepadSettings.m_enabled;
+    }
+    void FirstPersonControllerComponent::SetGamepadEnabled(const bool& new_gamepadEnabled)
+    {
+        if(m_gamepadSettings.m_enabled == new_gamepadEnabled)
+            return;
+        m_gamepadSettings.m_enabled = new_gamepadEnabled;
+        UpdateInputChannelFilter();
+    }
+    float FirstPersonControllerComponent::GetGamepadInnerDeadZone() const
+    {
+        return m_gamepadSettings.m_innerDeadZone;
+    }
+    void FirstPersonControllerComponent::SetGamepadInnerDeadZone(const float& new_gamepadInnerDeadZone)
+    {
+        m_gamepadSettings.m_innerDeadZone = new_gamepadInnerDeadZone;
+    }
+    float FirstPersonControllerComponent::GetGamepadOuterDeadZone() const
+    {
+        return m_gamepadSettings.m_outerDeadZone;
+    }
+    void FirstPersonControllerComponent::SetGamepadOuterDeadZone(const float& new_gamepadOuterDeadZone)
+    {
+        m_gamepadSettings.m_outerDeadZone = new_gamepadOuterDeadZone;
+    }
+    float FirstPersonControllerComponent::GetGamepadMoveResponseExponent() const
+    {
+        return m_gamepadSettings.m_moveResponseExponent;
+    }
+    void FirstPersonControllerComponent::SetGamepadMoveResponseExponent(const float& new_gamepadMoveResponseExponent)
+    {
+        m_gamepadSettings.m_moveResponseExponent = new_gamepadMoveResponseExponent;
+    }
+    float FirstPersonControllerComponent::GetGamepadLookResponseExponent() const
+    {
+        return m_gamepadSettings.m_lookResponseExponent;
+    }
+    void FirstPersonControllerComponent::SetGamepadLookResponseExponent(const float& new_gamepadLookResponseExponent)
+    {
+        m_gamepadSettings.m_lookResponseExponent = new_gamepadLookResponseExponent;
+    }
+    float FirstPersonControllerComponent::GetGamepadLookYawSpeed() const
+    {
+        return m_gamepadSettings.m_lookYawSpeed;
+    }
+    void FirstPersonControllerComponent::SetGamepadLookYawSpeed(const float& new_gamepadLookYawSpeed)
+    {
+        m_gamepadSettings.m_lookYawSpeed = new_gamepadLookYawSpeed;
+    }
+    float FirstPersonControllerComponent::GetGamepadLookPitchSpeed() const
+    {
+        return m_gamepadSettings.m_lookPitchSpeed;
+    }
+    void FirstPersonControllerComponent::SetGamepadLookPitchSpeed(const float& new_gamepadLookPitchSpeed)
+    {
+        m_gamepadSettings.m_lookPitchSpeed = new_gamepadLookPitchSpeed;
+    }
+    float FirstPersonControllerComponent::GetGamepadLookAccelerationScale() const
+    {
+        return m_gamepadSettings.m_lookAccelerationScale;
+    }
+    void FirstPersonControllerComponent::SetGamepadLookAccelerationScale(const float& new_gamepadLookAccelerationScale)
+    {
+        m_gamepadSettings.m_lookAccelerationScale = new_gamepadLookAccelerationScale;
+    }
+    float FirstPersonControllerComponent::GetGamepadLookAccelerationTime() const
+    {
+        return m_gamepadSettings.m_lookAccelerationTime;
+    }
+    void FirstPersonControllerComponent::SetGamepadLookAccelerationTime(const float& new_gamepadLookAccelerationTime)
+    {
+        m_gamepadSettings.m_lookAccelerationTime = new_gamepadLookAccelerationTime;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetReceivedInputEventsPerSecond() const
+    {
+        return m_inputEventsReceivedPerSecond;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetChangedInputEventsPerSecond() const
+    {
+        return m_inputEventsChangedPerSecond;
+    }
 }
@@ -5,6 +5,12 @@
 #pragma once
 #include <FirstPersonController/FirstPersonControllerComponentBus.h>
 
+#include <Clients/ControllerStepScheduler.h>
+#include <Clients/DeferredEventQueue.h>
+#include <Clients/GamepadInput.h>
+#include <Clients/InputOverrideStack.h>
+#include <Clients/PlatformVelocity.h>
+
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Vector3.h>
@@ -12,6 +18,7 @@
 #include <AzCore/std/containers/map.h>
 
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/CharacterBus.h>
 #include <AzFramework/Input/Events/InputChannelEventListener.h>
 
@@ -28,6 +35,7 @@ namespace FirstPersonController
         , public AzFramework::InputChannelEventListener
         , public StartingPointInput::InputEventNotificationBus::MultiHandler
         , public FirstPersonControllerComponentRequestBus::Handler
+        , public SteppedController
     {
     public:
         AZ_COMPONENT(FirstPersonControllerComponent, "{0a47c7c2-0f94-48dd-8e3f-fd55c30475b9}");
@@ -54,7 +62,8 @@ namespace FirstPersonController
         bool OnInputChannelEventFiltered(const AzFramework::InputChannel& inputChannel) override;
 
         // Gamepad Events
-        void OnGamepadEvent(const AzFramework::InputChannel& inputChannel);
+        bool OnGamepadEvent(const AzFramework::InputChannel& inputChannel);
+        void UpdateInputChannelFilter();
 
         // TickBus interface
         void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
@@ -336,6 +345,88 @@ namespace FirstPersonController
         float GetHeading() const override;
         void SetHeadingForTick(const float& new_currentHeading) override;
         float GetPitch() const override;
+        bool GetLodEnabled() const override;
+        void SetLodEnabled(const bool& new_lodEnabled) override;
+        float GetLodReducedDistance() const override;
+        void SetLodReducedDistance(const float& new_lodReducedDistance) override;
+        float GetLodMinimalDistance() const override;
+        void SetLodMinimalDistance(const float& new_lodMinimalDistance) override;
+        AZ::u32 GetLodReducedStepInterval() const override;
+        void SetLodReducedStepInterval(const AZ::u32& new_lodReducedStepInterval) override;
+        AZ::u32 GetLodMinimalStepInterval() const override;
+        void SetLodMinimalStepInterval(const AZ::u32& new_lodMinimalStepInterval) override;
+        AZ::u8 GetLodTier() const override;
+        float GetCapsuleResizeQuantum() const override;
+        void SetCapsuleResizeQuantum(const float& new_capsuleResizeQuantum) override;
+        AZ::u32 GetCapsuleResizesSavedLastTransition() const override;
+        bool GetLookInputRedirected() const override;
+        void SetLookInputRedirected(const bool& new_lookInputRedirected) override;
+        AZ::Vector2 GetGamepadLookDelta() const override;
+        bool GetInheritPlatformVelocity() const override;
+        void SetInheritPlatformVelocity(const bool& new_inheritPlatformVelocity) override;
+        bool GetPlatformRotationTurnsCharacter() const override;
+        void SetPlatformRotationTurnsCharacter(const bool& new_platformRotationTurnsCharacter) override;
+        AZ::EntityId GetPlatformEntityId() const override;
+        AZ::Vector3 GetPlatformVelocity() const override;
+        void EnterLadder(const AZ::EntityId& ladderEntityId) override;
+        void ExitLadder(const AZ::EntityId& ladderEntityId) override;
+        bool GetClimbingLadder() const override;
+        AZ::EntityId GetLadderEntityId() const override;
+        bool GetLadderClimbingEnabled() const override;
+        void SetLadderClimbingEnabled(const bool& new_ladderClimbingEnabled) override;
+        float GetLadderClimbSpeed() const override;
+        void SetLadderClimbSpeed(const float& new_ladderClimbSpeed) override;
+        float GetLadderStrafeScale() const override;
+        void SetLadderStrafeScale(const float& new_ladderStrafeScale) override;
+        float GetLadderLookDownAngle() const override;
+        void SetLadderLookDownAngle(const float& new_ladderLookDownAngle) override;
+        float GetLadderJumpOffSpeed() const override;
+        void SetLadderJumpOffSpeed(const float& new_ladderJumpOffSpeed) override;
+        bool Teleport(const AZ::Vector3& position) override;
+        void ResetVelocity() override;
+        void Launch(const AZ::Vector3& velocity) override;
+        bool GetAlwaysQuerySceneCasts() const override;
+        void SetAlwaysQuerySceneCasts(const bool& new_alwaysQuerySceneCasts) override;
+        AZ::u32 GetIssuedSceneCastsPerSecond() const override;
+        AZ::u32 GetSkippedSceneCastsPerSecond() const override;
+        AZStd::string GetQuerySceneName() const override;
+        void SetQuerySceneName(const AZStd::string& new_querySceneName) override;
+        bool GetBroadcastNotifications() const override;
+        void SetBroadcastNotifications(const bool& new_broadcastNotifications) override;
+        FirstPersonControllerState GetStateSnapshot() const override;
+        void ApplyStateOverrides(const FirstPersonControllerState& new_state) override;
+        AZ::u32 PushInputOverride(const InputOverride& inputOverride) override;
+        bool PopInputOverride(const AZ::u32& handle) override;
+        void ClearInputOverrides() override;
+        AZ::u32 GetInputOverrideCount() const override;
+        bool GetGamepadEnabled() const override;
+        void SetGamepadEnabled(const bool& new_gamepadEnabled) override;
+        float GetGamepadInnerDeadZone() const override;
+        void SetGamepadInnerDeadZone(const float& new_gamepadInnerDeadZone) override;
+        float GetGamepadOuterDeadZone() const override;
+        void SetGamepadOuterDeadZone(const float& new_gamepadOuterDeadZone) override;
+        float GetGamepadMoveResponseExponent() const override;
+        void SetGamepadMoveResponseExponent(const float& new_gamepadMoveResponseExponent) override;
+        float GetGamepadLookResponseExponent() const override;
+        void SetGamepadLookResponseExponent(const float& new_gamepadLookResponseExponent) override;
+        float GetGamepadLookYawSpeed() const override;
+        void SetGamepadLookYawSpeed(const float& new_gamepadLookYawSpeed) override;
+        float GetGamepadLookPitchSpeed() const override;
+        void SetGamepadLookPitchSpeed(const float& new_gamepadLookPitchSpeed) override;
+        float GetGamepadLookAccelerationScale() const override;
+        void SetGamepadLookAccelerationScale(const float& new_gamepadLookAccelerationScale) override;
+        float GetGamepadLookAccelerationTime() const override;
+        void SetGamepadLookAccelerationTime(const float& new_gamepadLookAccelerationTime) override;
+        AZ::u32 GetReceivedInputEventsPerSecond() const override;
+        AZ::u32 GetChangedInputEventsPerSecond() const override;
+
+        // SteppedController stages of a movement step, run back to back by ProcessInput or by the ControllerStepScheduler
+        bool BeginStep(float& stepDeltaTime, const bool& timestepElseTick) override;
+        void PlanSceneQueries() override;
+        void FinishStep(const float& stepDeltaTime) override;
+        // Restores the input values replaced by input overrides and dispatches the notifications queued since BeginStep,
+        // once the step and every other scheduled step are done
+        void EndStep() override;
 
     private:
         // Input event assignment and notification bus connection
@@ -361,6 +452,31 @@ namespace FirstPersonController
         void SmoothRotation(const float& deltaTime);
         void SprintManager(const AZ::Vector2& targetVelocity, const float& deltaTime);
         void CrouchManager(const float& deltaTime);
+        bool CrouchingNextStep() const;
+        void UpdateLodTier();
+        bool LodStepDue(float& stepDeltaTime);
+        void ResolveQueryScene();
+        void AttachStepping();
+        void UpdateHeadHit();
+        bool HeadSphereCastNeeded() const;
+        void UpdateSphereCastRequest(AZStd::shared_ptr<AzPhysics::ShapeCastRequest>& request, const float& radius,
+            const AZ::Transform& pose, const AZ::Vector3& direction, const float& distance, const AzPhysics::CollisionGroup& collisionGroup);
+        void UpdateSceneCastCounters(const float& deltaTime);
+        void UpdateInputEventCounters(const float& deltaTime);
+        void SubmitTargetVelocity();
+        void UpdatePlatformVelocity(const float& deltaTime);
+        float GetLadderClimbVelocity() const;
+        void StopClimbing();
+        void ResizeCapsule(const AZ::s8& direction, const bool& transitionEnded);
+        void FlushCapsuleResize();
+        using NotificationEvent = void (FirstPersonControllerNotifications::*)();
+        void QueueNotification(NotificationEvent notification);
+        void DispatchNotification(NotificationEvent notification);
+        void FlushNotifications();
+        AZStd::array<float*, InputOverrideChannelCount> GetInputChannelValuePointers();
+        void ApplyInputOverrides(const bool& timestepElseTick);
+        void RestoreOverriddenInput();
+        void ProcessGamepadInput(const float& deltaTime);
 
         // FirstPersonControllerNotificationBus
         void OnGroundHit();
@@ -387,6 +503,8 @@ namespace FirstPersonController
         void OnSprintStarted();
         void OnCooldownStarted();
         void OnCooldownDone();
+        void OnStartedClimbing();
+        void OnStoppedClimbing();
 
         // Provides the functionality when AddVelocityForPhysicsTimestep is used
         void OnSceneSimulationStart(float physicsTimestep);
@@ -503,6 +621,15 @@ namespace FirstPersonController
         float m_capsuleRadius = 0.3f;
         float m_capsuleHeight = 1.8f;
         float m_capsuleCurrentHeight = 1.8f;
+        // Height of the PhysX capsule, which is only resized once the tracked height has moved by the resize quantum,
+        // or when a crouch or stand transition ends, is reversed or stops partway
+        float m_capsuleResizedHeight = 1.8f;
+        float m_capsuleResizeQuantum = 0.05f;
+        // Direction of the transition being coalesced, -1 while crouching down, 1 while standing up and 0 when there is none
+        AZ::s8 m_capsuleResizeDirection = 0;
+        AZ::u32 m_capsuleResizesSkipped = 0;
+        AZ::u32 m_capsuleResizesSavedLastTransition = 0;
+        float m_stepHeight = 0.f;
         // The grounded sphere cast offset determines how far below the character's feet the ground is detected
         float m_groundedSphereCastOffset = 0.001f;
         // The ground close sphere cast offset determines how far below the character's feet the ground is considered to be close
@@ -527,6 +654,92 @@ namespace FirstPersonController
         AZStd::vector<AZ::EntityId> m_headHitEntityIds;
         float m_jumpHeadSphereCastOffset = 0.1f;
 
+        // Moving platforms, the velocity of the ground the character stands on is added to the target velocity
+        bool m_inheritPlatformVelocity = false;
+        bool m_platformRotationTurnsCharacter = true;
+        AZ::EntityId m_platformEntityId;
+        AZ::Vector3 m_platformVelocity = AZ::Vector3::CreateZero();
+        PlatformVelocityTracker m_platformTracker;
+
+        // Ladder climbing, the ladder volume puts the character in and out of climb mode on its trigger events
+        bool m_ladderClimbingEnabled = true;
+        float m_ladderClimbSpeed = 2.5f;
+        float m_ladderStrafeScale = 0.5f;
+        float m_ladderLookDownAngle = 30.f;
+        float m_ladderJumpOffSpeed = 3.f;
+        bool m_climbingLadder = false;
+        AZ::EntityId m_ladderEntityId;
+        float m_ladderClimbSpeedScale = 1.f;
+
+        // Velocity applied at the start of the next movement step by Launch()
+        bool m_launchPending = false;
+        AZ::Vector3 m_launchVelocity = AZ::Vector3::CreateZero();
+
+        // Level of detail, used to reduce the cost of controllers that are far from the active camera
+        bool m_lodEnabled = false;
+        float m_lodReducedDistance = 25.f;
+        float m_lodMinimalDistance = 60.f;
+        AZ::u32 m_lodReducedStepInterval = 2;
+        AZ::u32 m_lodMinimalStepInterval = 4;
+        LodTier m_lodTier = LodTier::Full;
+        AZ::u32 m_lodSkippedSteps = 0;
+        float m_lodAccumulatedDeltaTime = 0.f;
+
+        // Scene query scheduling, the head and stand casts are skipped when their result can't be used
+        // and the planned casts are issued together at the start of each step
+        bool m_alwaysQuerySceneCasts = false;
+        AZStd::string m_querySceneName;
+        AzPhysics::SceneInterface* m_sceneInterface = nullptr;
+        AzPhysics::SceneHandle m_querySceneHandle = AzPhysics::InvalidSceneHandle;
+        AzPhysics::SystemEvents::OnSceneAddedEvent::Handler m_sceneAddedHandler;
+        AzPhysics::SystemEvents::OnSceneRemovedEvent::Handler m_sceneRemovedHandler;
+        AzPhysics::SceneQueryHits m_groundQueryHits;
+        AzPhysics::SceneQueryHits m_headQueryHits;
+        AzPhysics::SceneQueryHits m_standQueryHits;
+        bool m_headQueryPlanned = false;
+        bool m_standQueryPlanned = false;
+        // The requests are created on the first step that needs them and updated in place afterwards
+        AZStd::shared_ptr<AzPhysics::RayCastRequest> m_groundRayCastRequest;
+        AZStd::shared_ptr<AzPhysics::ShapeCastRequest> m_groundSphereCastRequest;
+        AZStd::shared_ptr<AzPhysics::ShapeCastRequest> m_headSphereCastRequest;
+        AZStd::shared_ptr<AzPhysics::ShapeCastRequest> m_standSphereCastRequest;
+        AzPhysics::SceneQueryRequests m_sceneQueryRequests;
+        AZ::u32 m_sceneCastsIssuedAccum = 0;
+        AZ::u32 m_sceneCastsSkippedAccum = 0;
+        AZ::u32 m_sceneCastsIssuedPerSecond = 0;
+        AZ::u32 m_sceneCastsSkippedPerSecond = 0;
+        float m_sceneCastWindowTime = 0.f;
+
+        // Notifications raised during a step are queued and dispatched together after it,
+        // so that handlers don't run in the middle of the step's computations
+        DeferredEventQueue<NotificationEvent> m_queuedNotifications;
+        // Sends the notifications to every handler on the bus as earlier versions did, on by default so that existing
+        // global handlers keep receiving them; disabling it addresses them to this controller's handlers only
+        bool m_broadcastNotifications = true;
+
+        // Input overrides pushed by scripts, applied at the start of each step over the input values,
+        // which are restored once the step is done unless an input event changed them during the step
+        InputOverrideStack m_inputOverrides;
+        InputChannelValues m_rawInputValues = {};
+        InputChannelValues m_appliedInputValues = {};
+        AZ::u32 m_overriddenInputMask = 0;
+
+        // Gamepad thumbstick values as last received, processed once per tick
+        GamepadInputSettings m_gamepadSettings;
+        GamepadInputProcessor m_gamepadInput;
+        AZ::Vector2 m_gamepadLeftStick = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_gamepadRightStick = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_gamepadMove = AZ::Vector2::CreateZero();
+        AZ::Vector2 m_gamepadLookDelta = AZ::Vector2::CreateZero();
+
+        // Input channel events received by the listener and those of them that changed a cached stick value, over one second
+        // windows. A changed value isn't necessarily used, only the latest value per tick reaches the movement.
+        AZ::u32 m_inputEventsReceivedAccum = 0;
+        AZ::u32 m_inputEventsChangedAccum = 0;
+        AZ::u32 m_inputEventsReceivedPerSecond = 0;
+        AZ::u32 m_inputEventsChangedPerSecond = 0;
+        float m_inputEventWindowTime = 0.f;
+
         // Variables used to determine when the X&Y velocity should be updated
         bool m_updateXYAscending = true;
         bool m_updateXYDecending = true;
@@ -546,6 +759,8 @@ namespace FirstPersonController
         bool m_cameraSlerpInsteadOfLerpRotation = true;
         bool m_updateCameraYawIgnoresInput = false;
         bool m_updateCameraPitchIgnoresInput = false;
+        // When redirected the yaw and pitch input values are left for another component to consume, e.g. to inspect a held object
+        bool m_lookInputRedirected = false;
         float m_cameraPitchMaxAngle = AZ::Constants::HalfPi;
         float m_cameraPitchMinAngle = -AZ::Constants::HalfPi;
 
@@ -0,0 +1,404 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/FirstPersonControllerNetworkComponent.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/chrono/chrono.h>
+
+#include <AzFramework/Physics/CharacterBus.h>
+
+namespace FirstPersonController
+{
+    void FirstPersonControllerNetworkComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<FirstPersonControllerNetworkComponent, AZ::Component>()
+              ->Field("Authority", &FirstPersonControllerNetworkComponent::m_authority)
+              ->Field("Peer Entity", &FirstPersonControllerNetworkComponent::m_peerEntityId)
+              ->Field("Loopback Latency (ticks)", &FirstPersonControllerNetworkComponent::m_loopbackLatencyTicks)
+              ->Field("Correction Tolerance (m)", &FirstPersonControllerNetworkComponent::m_correctionTolerance)
+              ->Field("Input History Size", &FirstPersonControllerNetworkComponent::m_inputHistorySize)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Class<FirstPersonControllerNetworkComponent>("First Person Controller Network",
+                    "Server-authoritative movement for the First Person Controller with client prediction and reconciliation")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerNetworkComponent::m_authority,
+                        "Authority", "Determines whether this controller is the authority (server) or the autonomous (predicting client) side.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerNetworkComponent::m_peerEntityId,
+                        "Peer Entity", "The entity with the other side's First Person Controller Network component, the loopback transport sends frames to it.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerNetworkComponent::m_loopbackLatencyTicks,
+                        "Loopback Latency (ticks)", "Number of ticks the loopback transport holds each frame before delivering it to the peer entity.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerNetworkComponent::m_correctionTolerance,
+                        "Correction Tolerance (m)", "Distance between the predicted and authoritative positions above which the autonomous controller is corrected.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerNetworkComponent::m_inputHistorySize,
+                        "Input History Size", "Maximum number of unacknowledged moves kept for replay, and of received input frames kept for stepping.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1);
+            }
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->EBus<FirstPersonControllerNetworkComponentRequestBus>("FirstPersonControllerNetworkComponentRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Get Network Role", &FirstPersonControllerNetworkComponentRequests::GetNetworkRole)
+                ->Event("Get Peer EntityId", &FirstPersonControllerNetworkComponentRequests::GetPeerEntityId)
+                ->Event("Set Peer EntityId", &FirstPersonControllerNetworkComponentRequests::SetPeerEntityId)
+                ->Event("Get Loopback Latency Ticks", &FirstPersonControllerNetworkComponentRequests::GetLoopbackLatencyTicks)
+                ->Event("Set Loopback Latency Ticks", &FirstPersonControllerNetworkComponentRequests::SetLoopbackLatencyTicks)
+                ->Event("Get Correction Tolerance", &FirstPersonControllerNetworkComponentRequests::GetCorrectionTolerance)
+                ->Event("Set Correction Tolerance", &FirstPersonControllerNetworkComponentRequests::SetCorrectionTolerance)
+                ->Event("Get Bytes Sent Per Second", &FirstPersonControllerNetworkComponentRequests::GetBytesSentPerSecond)
+                ->Event("Get Bytes Received Per Second", &FirstPersonControllerNetworkComponentRequests::GetBytesReceivedPerSecond)
+                ->Event("Get Correction Count", &FirstPersonControllerNetworkComponentRequests::GetCorrectionCount)
+                ->Event("Get Replayed Input Count", &FirstPersonControllerNetworkComponentRequests::GetReplayedInputCount)
+                ->Event("Get Last Rollback Microseconds", &FirstPersonControllerNetworkComponentRequests::GetLastRollbackMicroseconds)
+                ->Event("Get Max Rollback Microseconds", &FirstPersonControllerNetworkComponentRequests::GetMaxRollbackMicroseconds)
+                ->Event("Get Unacknowledged Input Count", &FirstPersonControllerNetworkComponentRequests::GetUnacknowledgedInputCount)
+                ->Event("Reset Network Counters", &FirstPersonControllerNetworkComponentRequests::ResetNetworkCounters);
+
+            bc->Class<FirstPersonControllerNetworkComponent>()->RequestBus("FirstPersonControllerNetworkComponentRequestBus");
+        }
+    }
+
+    void FirstPersonControllerNetworkComponent::Activate()
+    {
+        m_predictedMoves.Clear();
+        m_receivedInputs.Clear();
+        m_pendingInputFrames.clear();
+        m_pendingStateFrames.clear();
+        m_hasStepInput = false;
+        m_stateDue = false;
+
+        AZ::TickBus::Handler::BusConnect();
+        ControllerStepInputNotificationBus::Handler::BusConnect(GetEntityId());
+        FirstPersonControllerNetworkTransportNotificationBus::Handler::BusConnect(GetEntityId());
+        FirstPersonControllerNetworkComponentRequestBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void FirstPersonControllerNetworkComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        ControllerStepInputNotificationBus::Handler::BusDisconnect();
+        FirstPersonControllerNetworkTransportNotificationBus::Handler::BusDisconnect();
+        FirstPersonControllerNetworkComponentRequestBus::Handler::BusDisconnect();
+    }
+
+    void FirstPersonControllerNetworkComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("FirstPersonControllerService"));
+        required.push_back(AZ_CRC_CE("TransformService"));
+    }
+
+    void FirstPersonControllerNetworkComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("FirstPersonControllerNetworkService"));
+    }
+
+    void FirstPersonControllerNetworkComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("FirstPersonControllerNetworkService"));
+    }
+
+    void FirstPersonControllerNetworkComponent::OnTick(float deltaTime, AZ::ScriptTimePoint)
+    {
+        ++m_tickCount;
+
+        DeliverLoopbackFrames();
+        UpdateBandwidthCounters(deltaTime);
+    }
+
+    void FirstPersonControllerNetworkComponent::OnStepInput(InputChannelValues& values, const bool& timestepElseTick)
+    {
+        // A move is made of the input of one tick, the steps on the physics timesteps in between reuse it
+        if(!timestepElseTick)
+        {
+            if(!m_authority)
+            {
+                SendSteppedMove();
+                CaptureInput(values);
+            }
+            else
+            {
+                SendState();
+                StepReceivedInput();
+            }
+        }
+
+        if(m_hasStepInput)
+            WriteStepInput(values);
+    }
+
+    void FirstPersonControllerNetworkComponent::SendSteppedMove()
+    {
+        // The controller has stepped the last captured move since the previous tick, so its resulting position
+        // and the heading that it moved along are now known
+        AZ::Vector3 positionAfter = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(positionAfter, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+        float heading = 0.f;
+        FirstPersonControllerComponentRequestBus::EventResult(heading, GetEntityId(),
+            &FirstPersonControllerComponentRequestBus::Events::GetHeading);
+
+        InputFrame frame;
+        if(!m_predictedMoves.CompleteLastMove(heading, positionAfter, frame) || !m_peerEntityId.IsValid())
+            return;
+
+        m_bytesSentAccum += frame.GetWireSize();
+        m_pendingInputFrames.push_back({AZStd::move(frame), m_tickCount + m_loopbackLatencyTicks});
+    }
+
+    void FirstPersonControllerNetworkComponent::CaptureInput(const InputChannelValues& values)
+    {
+        // The values are in the order of the InputOverrideChannel bits
+        ControllerSnapshot input;
+        input.m_forwardValue = values[0];
+        input.m_backValue = values[1];
+        input.m_leftValue = values[2];
+        input.m_rightValue = values[3];
+        input.m_yawValue = values[4];
+        input.m_pitchValue = values[5];
+        input.m_sprintValue = values[6];
+        input.m_crouchValue = values[7];
+        input.m_jumpValue = values[8];
+
+        // Predict with exactly the input values that the authority will step with
+        m_stepInput = QuantizeInput(input);
+        m_hasStepInput = true;
+
+        AZ::Vector3 positionBefore = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(positionBefore, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+        m_predictedMoves.Push(m_nextSequence++, m_stepInput, positionBefore, m_inputHistorySize);
+    }
+
+    void FirstPersonControllerNetworkComponent::WriteStepInput(InputChannelValues& values) const
+    {
+        values[0] = m_stepInput.m_forwardValue;
+        values[1] = m_stepInput.m_backValue;
+        values[2] = m_stepInput.m_leftValue;
+        values[3] = m_stepInput.m_rightValue;
+        values[6] = m_stepInput.m_sprintValue;
+        values[7] = m_stepInput.m_crouchValue;
+        values[8] = m_stepInput.m_jumpValue;
+
+        // The authority follows the autonomous controller's heading rather than integrating the rotation input itself
+        values[4] = m_authority ? 0.f : m_stepInput.m_yawValue;
+        values[5] = m_authority ? 0.f : m_stepInput.m_pitchValue;
+    }
+
+    void FirstPersonControllerNetworkComponent::Reconcile(const StateFrame& frame)
+    {
+        const auto rollbackStart = AZStd::chrono::steady_clock::now();
+
+        AZ::Vector3 correctedPosition = frame.m_position;
+        AZ::u32 replayedMoves = 0;
+        if(!m_predictedMoves.Reconcile(frame, m_correctionTolerance, correctedPosition, replayedMoves))
+            return;
+
+        Physics::CharacterRequestBus::Event(GetEntityId(),
+            &Physics::CharacterRequestBus::Events::SetBasePosition, correctedPosition);
+
+        // Only take the authority's velocities when there is nothing left to replay, otherwise they're stale
+        if(m_predictedMoves.IsCaughtUp())
+        {
+            FirstPersonControllerComponentRequestBus::Event(GetEntityId(),
+                &FirstPersonControllerComponentRequestBus::Events::SetApplyVelocityXY, frame.m_applyVelocityXY);
+            FirstPersonControllerComponentRequestBus::Event(GetEntityId(),
+                &FirstPersonControllerComponentRequestBus::Events::SetApplyVelocityZ, frame.m_applyVelocityZ);
+        }
+
+        m_replayedInputCount += replayedMoves;
+        ++m_correctionCount;
+        m_lastRollbackMicroseconds = AZStd::chrono::duration<float, AZStd::micro>(
+            AZStd::chrono::steady_clock::now() - rollbackStart).count();
+        m_maxRollbackMicroseconds = AZ::GetMax(m_maxRollbackMicroseconds, m_lastRollbackMicroseconds);
+    }
+
+    void FirstPersonControllerNetworkComponent::SendState()
+    {
+        // The state is sent once the controller has stepped the last received input
+        if(!m_stateDue || !m_peerEntityId.IsValid())
+            return;
+
+        m_stateDue = false;
+
+        StateFrame frame;
+        frame.m_ackSequence = m_receivedInputs.GetLastPoppedSequence();
+        AZ::TransformBus::EventResult(frame.m_position, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+        FirstPersonControllerComponentRequestBus::EventResult(frame.m_applyVelocityXY, GetEntityId(),
+            &FirstPersonControllerComponentRequestBus::Events::GetApplyVelocityXY);
+        FirstPersonControllerComponentRequestBus::EventResult(frame.m_applyVelocityZ, GetEntityId(),
+            &FirstPersonControllerComponentRequestBus::Events::GetApplyVelocityZ);
+
+        m_pendingStateFrames.push_back({frame, m_tickCount + m_loopbackLatencyTicks});
+        m_bytesSentAccum += StateFrame::WireSize;
+    }
+
+    void FirstPersonControllerNetworkComponent::StepReceivedInput()
+    {
+        // One input frame is stepped per tick, when none has arrived the controller keeps the last input
+        InputFrame frame;
+        if(!m_receivedInputs.Pop(frame))
+            return;
+
+        if(!UnpackInputFrame(frame, m_stepInput))
+        {
+            AZ_Warning("First Person Controller Network Component", false, "Input frame %u could not be unpacked, ignoring it.", frame.m_sequence);
+            return;
+        }
+        m_hasStepInput = true;
+
+        AZ::TransformBus::Event(GetEntityId(), &AZ::TransformBus::Events::SetWorldRotationQuaternion,
+            AZ::Quaternion::CreateRotationZ(m_stepInput.m_heading));
+
+        m_stateDue = true;
+    }
+
+    void FirstPersonControllerNetworkComponent::DeliverLoopbackFrames()
+    {
+        while(!m_pendingInputFrames.empty() && m_pendingInputFrames.front().m_deliveryTick <= m_tickCount)
+        {
+            const InputFrame frame = m_pendingInputFrames.front().m_frame;
+            m_pendingInputFrames.pop_front();
+            FirstPersonControllerNetworkTransportNotificationBus::Event(m_peerEntityId,
+                &FirstPersonControllerNetworkTransportNotificationBus::Events::OnInputFrameReceived, frame);
+        }
+
+        while(!m_pendingStateFrames.empty() && m_pendingStateFrames.front().m_deliveryTick <= m_tickCount)
+        {
+            const StateFrame frame = m_pendingStateFrames.front().m_frame;
+            m_pendingStateFrames.pop_front();
+            FirstPersonControllerNetworkTransportNotificationBus::Event(m_peerEntityId,
+                &FirstPersonControllerNetworkTransportNotificationBus::Events::OnStateFrameReceived, frame);
+        }
+    }
+
+    void FirstPersonControllerNetworkComponent::UpdateBandwidthCounters(const float& deltaTime)
+    {
+        m_bandwidthWindowTime += deltaTime;
+        if(m_bandwidthWindowTime < 1.f)
+            return;
+
+        m_bytesSentPerSecond = static_cast<AZ::u32>(m_bytesSentAccum / m_bandwidthWindowTime);
+        m_bytesReceivedPerSecond = static_cast<AZ::u32>(m_bytesReceivedAccum / m_bandwidthWindowTime);
+        m_bytesSentAccum = 0;
+        m_bytesReceivedAccum = 0;
+        m_bandwidthWindowTime = 0.f;
+    }
+
+    void FirstPersonControllerNetworkComponent::OnInputFrameReceived(const InputFrame& frame)
+    {
+        m_bytesReceivedAccum += frame.GetWireSize();
+
+        if(!m_authority)
+        {
+            AZ_Warning("First Person Controller Network Component", false, "Input frame received by an autonomous controller, ignoring it.");
+            return;
+        }
+
+        m_receivedInputs.Push(frame, m_inputHistorySize);
+    }
+
+    void FirstPersonControllerNetworkComponent::OnStateFrameReceived(const StateFrame& frame)
+    {
+        m_bytesReceivedAccum += StateFrame::WireSize;
+
+        if(m_authority)
+        {
+            AZ_Warning("First Person Controller Network Component", false, "State frame received by the authority, ignoring it.");
+            return;
+        }
+
+        Reconcile(frame);
+    }
+
+    // Request Bus getter and setter methods for use in scripts
+    AZ::u8 FirstPersonControllerNetworkComponent::GetNetworkRole() const
+    {
+        return static_cast<AZ::u8>(m_authority ? NetworkRole::Authority : NetworkRole::Autonomous);
+    }
+    AZ::EntityId FirstPersonControllerNetworkComponent::GetPeerEntityId() const
+    {
+        return m_peerEntityId;
+    }
+    void FirstPersonControllerNetworkComponent::SetPeerEntityId(const AZ::EntityId& new_peerEntityId)
+    {
+        m_peerEntityId = new_peerEntityId;
+    }
+    AZ::u32 FirstPersonControllerNetworkComponent::GetLoopbackLatencyTicks() const
+    {
+        return m_loopbackLatencyTicks;
+    }
+    void FirstPersonControllerNetworkComponent::SetLoopbackLatencyTicks(const AZ::u32& new_loopbackLatencyTicks)
+    {
+        m_loopbackLatencyTicks = new_loopbackLatencyTicks;
+    }
+    float FirstPersonControllerNetworkComponent::GetCorrectionTolerance() const
+    {
+        return m_correctionTolerance;
+    }
+    void FirstPersonControllerNetworkComponent::SetCorrectionTolerance(const float& new_correctionTolerance)
+    {
+        m_correctionTolerance = AZ::GetMax(new_correctionTolerance, 0.f);
+    }
+    AZ::u32 FirstPersonControllerNetworkComponent::GetBytesSentPerSecond() const
+    {
+        return m_bytesSentPerSecond;
+    }
+    AZ::u32 FirstPersonControllerNetworkComponent::GetBytesReceivedPerSecond() const
+    {
+        return m_bytesReceivedPerSecond;
+    }
+    AZ::u32 FirstPersonControllerNetworkComponent::GetCorrectionCount() const
+    {
+        return m_correctionCount;
+    }
+    AZ::u32 FirstPersonControllerNetworkComponent::GetReplayedInputCount() const
+    {
+        return m_replayedInputCount;
+    }
+    float FirstPersonControllerNetworkComponent::GetLastRollbackMicroseconds() const
+    {
+        return m_lastRollbackMicroseconds;
+    }
+    float FirstPersonControllerNetworkComponent::GetMaxRollbackMicroseconds() const
+    {
+        return m_maxRollbackMicroseconds;
+    }
+    AZ::u32 FirstPersonControllerNetworkComponent::GetUnacknowledgedInputCount() const
+    {
+        return m_predictedMoves.GetCount();
+    }
+    void FirstPersonControllerNetworkComponent::ResetNetworkCounters()
+    {
+        m_bytesSentAccum = 0;
+        m_bytesReceivedAccum = 0;
+        m_bytesSentPerSecond = 0;
+        m_bytesReceivedPerSecond = 0;
+        m_bandwidthWindowTime = 0.f;
+        m_correctionCount = 0;
+        m_replayedInputCount = 0;
+        m_lastRollbackMicroseconds = 0.f;
+        m_maxRollbackMicroseconds = 0.f;
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,118 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+#include <FirstPersonController/FirstPersonControllerNetworkComponentBus.h>
+
+#include <Clients/ControllerStepInputBus.h>
+#include <Clients/NetworkPrediction.h>
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/deque.h>
+
+namespace FirstPersonController
+{
+    class FirstPersonControllerNetworkComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public ControllerStepInputNotificationBus::Handler
+        , public FirstPersonControllerNetworkTransportNotificationBus::Handler
+        , public FirstPersonControllerNetworkComponentRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(FirstPersonControllerNetworkComponent, "{6b1d7f4e-3c52-4a8e-9f21-0d8a5c7e94b3}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // TickBus interface
+        void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
+
+        // ControllerStepInputNotificationBus
+        void OnStepInput(InputChannelValues& values, const bool& timestepElseTick) override;
+
+        // FirstPersonControllerNetworkTransportNotificationBus
+        void OnInputFrameReceived(const InputFrame& frame) override;
+        void OnStateFrameReceived(const StateFrame& frame) override;
+
+        // FirstPersonControllerNetworkComponentRequestBus
+        AZ::u8 GetNetworkRole() const override;
+        AZ::EntityId GetPeerEntityId() const override;
+        void SetPeerEntityId(const AZ::EntityId& new_peerEntityId) override;
+        AZ::u32 GetLoopbackLatencyTicks() const override;
+        void SetLoopbackLatencyTicks(const AZ::u32& new_loopbackLatencyTicks) override;
+        float GetCorrectionTolerance() const override;
+        void SetCorrectionTolerance(const float& new_correctionTolerance) override;
+        AZ::u32 GetBytesSentPerSecond() const override;
+        AZ::u32 GetBytesReceivedPerSecond() const override;
+        AZ::u32 GetCorrectionCount() const override;
+        AZ::u32 GetReplayedInputCount() const override;
+        float GetLastRollbackMicroseconds() const override;
+        float GetMaxRollbackMicroseconds() const override;
+        AZ::u32 GetUnacknowledgedInputCount() const override;
+        void ResetNetworkCounters() override;
+
+    private:
+        // Autonomous role
+        void SendSteppedMove();
+        void CaptureInput(const InputChannelValues& values);
+        void Reconcile(const StateFrame& frame);
+
+        // Authority role
+        void SendState();
+        void StepReceivedInput();
+
+        void WriteStepInput(InputChannelValues& values) const;
+
+        // Loopback transport with a simulated latency measured in ticks
+        void DeliverLoopbackFrames();
+        void UpdateBandwidthCounters(const float& deltaTime);
+
+        bool m_authority = false;
+        AZ::EntityId m_peerEntityId;
+        AZ::u32 m_loopbackLatencyTicks = 2;
+        float m_correctionTolerance = 0.05f;
+        AZ::u32 m_inputHistorySize = 64;
+
+        // The quantized input both sides step with during the current tick
+        ControllerSnapshot m_stepInput;
+        bool m_hasStepInput = false;
+
+        PredictedMoveHistory m_predictedMoves;
+        AZ::u16 m_nextSequence = 0;
+
+        ReceivedInputQueue m_receivedInputs;
+        bool m_stateDue = false;
+
+        // Frames held back by the loopback until their delivery tick
+        template<typename Frame>
+        struct PendingFrame
+        {
+            Frame m_frame;
+            AZ::u32 m_deliveryTick = 0;
+        };
+        AZStd::deque<PendingFrame<InputFrame>> m_pendingInputFrames;
+        AZStd::deque<PendingFrame<StateFrame>> m_pendingStateFrames;
+        AZ::u32 m_tickCount = 0;
+
+        // Counters
+        AZ::u32 m_bytesSentAccum = 0;
+        AZ::u32 m_bytesReceivedAccum = 0;
+        AZ::u32 m_bytesSentPerSecond = 0;
+        AZ::u32 m_bytesReceivedPerSecond = 0;
+        float m_bandwidthWindowTime = 0.f;
+        AZ::u32 m_correctionCount = 0;
+        AZ::u32 m_replayedInputCount = 0;
+        float m_lastRollbackMicroseconds = 0.f;
+        float m_maxRollbackMicroseconds = 0.f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,247 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/FirstPersonControllerSerializer.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/math.h>
+
+namespace FirstPersonController
+{
+    namespace
+    {
+        enum class FieldKind : AZ::u8
+        {
+            InputValue,
+            RotationInput,
+            Angle,
+            Velocity
+        };
+
+        // Order in which the fields are written
+        constexpr FieldKind FieldKinds[ControllerSnapshotSerializer::FieldCount] = {
+            FieldKind::InputValue,      // Forward
+            FieldKind::InputValue,      // Back
+            FieldKind::InputValue,      // Left
+            FieldKind::InputValue,      // Right
+            FieldKind::RotationInput,   // Yaw
+            FieldKind::RotationInput,   // Pitch
+            FieldKind::InputValue,      // Sprint
+            FieldKind::InputValue,      // Crouch
+            FieldKind::InputValue,      // Jump
+            FieldKind::Angle,           // Heading
+            FieldKind::Angle,           // Pitch angle
+            FieldKind::Velocity,        // Apply velocity X
+            FieldKind::Velocity,        // Apply velocity Y
+            FieldKind::Velocity         // Apply velocity Z
+        };
+
+        using SnapshotFields = AZStd::array<float, ControllerSnapshotSerializer::FieldCount>;
+
+        SnapshotFields ToFields(const ControllerSnapshot& snapshot)
+        {
+            return {{ snapshot.m_forwardValue, snapshot.m_backValue, snapshot.m_leftValue, snapshot.m_rightValue,
+                snapshot.m_yawValue, snapshot.m_pitchValue, snapshot.m_sprintValue, snapshot.m_crouchValue, snapshot.m_jumpValue,
+                snapshot.m_heading, snapshot.m_pitch,
+                snapshot.m_applyVelocityXY.GetX(), snapshot.m_applyVelocityXY.GetY(), snapshot.m_applyVelocityZ }};
+        }
+
+        ControllerSnapshot FromFields(const SnapshotFields& fields)
+        {
+            ControllerSnapshot snapshot;
+            snapshot.m_forwardValue = fields[0];
+            snapshot.m_backValue = fields[1];
+            snapshot.m_leftValue = fields[2];
+            snapshot.m_rightValue = fields[3];
+            snapshot.m_yawValue = fields[4];
+            snapshot.m_pitchValue = fields[5];
+            snapshot.m_sprintValue = fields[6];
+            snapshot.m_crouchValue = fields[7];
+            snapshot.m_jumpValue = fields[8];
+            snapshot.m_heading = fields[9];
+            snapshot.m_pitch = fields[10];
+            snapshot.m_applyVelocityXY = AZ::Vector2(fields[11], fields[12]);
+            snapshot.m_applyVelocityZ = fields[13];
+            return snapshot;
+        }
+
+        AZ::u8 FieldBits(const FieldKind& kind, const SnapshotQuantization& quantization)
+        {
+            AZ::u8 bits = quantization.m_inputValueBits;
+            if(kind == FieldKind::RotationInput)
+                bits = quantization.m_rotationInputBits;
+            else if(kind == FieldKind::Angle)
+                bits = quantization.m_angleBits;
+            else if(kind == FieldKind::Velocity)
+                bits = quantization.m_velocityBits;
+            return AZ::GetClamp<AZ::u8>(bits, 2, 31);
+        }
+
+        float FieldRange(const FieldKind& kind, const SnapshotQuantization& quantization)
+        {
+            if(kind == FieldKind::RotationInput)
+                return quantization.m_rotationInputRange;
+            else if(kind == FieldKind::Velocity)
+                return quantization.m_velocityRange;
+            return 1.f;
+        }
+
+        // Ranged values use an even number of steps so that zero is represented exactly,
+        // angles wrap around so the whole bit range is used
+        AZ::u32 QuantizeField(const float& value, const FieldKind& kind, const SnapshotQuantization& quantization)
+        {
+            const AZ::u8 bits = FieldBits(kind, quantization);
+            if(kind == FieldKind::Angle)
+            {
+                const double steps = static_cast<double>(1ull << bits);
+                const double turns = (static_cast<double>(value) + AZ::Constants::Pi) / AZ::Constants::TwoPi;
+                const double wrapped = turns - AZStd::floor(turns);
+                return static_cast<AZ::u32>(static_cast<AZ::u64>(wrapped * steps + 0.5) & ((1ull << bits) - 1));
+            }
+
+            const float range = FieldRange(kind, quantization);
+            const double steps = static_cast<double>((1ull << bits) - 2);
+            const double normalized = (AZ::GetClamp(value, -range, range) + range) / (2.f * range);
+            return static_cast<AZ::u32>(normalized * steps + 0.5);
+        }
+
+        float DequantizeField(const AZ::u32& value, const FieldKind& kind, const SnapshotQuantization& quantization)
+        {
+            const AZ::u8 bits = FieldBits(kind, quantization);
+            if(kind == FieldKind::Angle)
+                return static_cast<float>(static_cast<double>(value) / static_cast<double>(1ull << bits) * AZ::Constants::TwoPi - AZ::Constants::Pi);
+
+            const float range = FieldRange(kind, quantization);
+            const double steps = static_cast<double>((1ull << bits) - 2);
+            return static_cast<float>(static_cast<double>(value) / steps * 2.0 * range - range);
+        }
+    } // namespace
+
+    BitWriter::BitWriter(AZStd::vector<AZ::u8>& buffer)
+        : m_buffer(buffer)
+    {
+    }
+
+    void BitWriter::WriteBits(AZ::u32 value, AZ::u8 bitCount)
+    {
+        while(bitCount > 0)
+        {
+            const AZ::u8 bitOffset = static_cast<AZ::u8>(m_bitCount & 7);
+            if(bitOffset == 0)
+                m_buffer.push_back(0);
+
+            const AZ::u8 bitsToWrite = AZ::GetMin<AZ::u8>(bitCount, 8 - bitOffset);
+            m_buffer.back() |= static_cast<AZ::u8>((value & ((1u << bitsToWrite) - 1)) << bitOffset);
+
+            value >>= bitsToWrite;
+            bitCount -= bitsToWrite;
+            m_bitCount += bitsToWrite;
+        }
+    }
+
+    void BitWriter::WriteBool(bool value)
+    {
+        WriteBits(value ? 1 : 0, 1);
+    }
+
+    AZ::u32 BitWriter::GetBitCount() const
+    {
+        return m_bitCount;
+    }
+
+    BitReader::BitReader(const AZ::u8* data, AZ::u32 byteCount)
+        : m_data(data)
+        , m_bitSize(byteCount * 8)
+    {
+    }
+
+    AZ::u32 BitReader::ReadBits(AZ::u8 bitCount)
+    {
+        if(m_overflowed || m_bitPosition + bitCount > m_bitSize)
+        {
+            m_overflowed = true;
+            return 0;
+        }
+
+        AZ::u32 value = 0;
+        AZ::u8 shift = 0;
+        while(bitCount > 0)
+        {
+            const AZ::u8 bitOffset = static_cast<AZ::u8>(m_bitPosition & 7);
+            const AZ::u8 bitsToRead = AZ::GetMin<AZ::u8>(bitCount, 8 - bitOffset);
+            const AZ::u32 bits = (m_data[m_bitPosition >> 3] >> bitOffset) & ((1u << bitsToRead) - 1);
+
+            value |= bits << shift;
+            shift += bitsToRead;
+            bitCount -= bitsToRead;
+            m_bitPosition += bitsToRead;
+        }
+        return value;
+    }
+
+    bool BitReader::ReadBool()
+    {
+        return ReadBits(1) != 0;
+    }
+
+    bool BitReader::IsOverflowed() const
+    {
+        return m_overflowed;
+    }
+
+    void ControllerSnapshotSerializer::Serialize(const ControllerSnapshot& snapshot, const ControllerSnapshot* baseline,
+        const SnapshotQuantization& quantization, BitWriter& writer)
+    {
+        const SnapshotFields fields = ToFields(snapshot);
+        const SnapshotFields baselineFields = baseline != nullptr ? ToFields(*baseline) : SnapshotFields{};
+
+        for(AZ::u8 i = 0; i < FieldCount; ++i)
+        {
+            const AZ::u32 value = QuantizeField(fields[i], FieldKinds[i], quantization);
+
+            if(baseline != nullptr)
+            {
+                const bool changed = value != QuantizeField(baselineFields[i], FieldKinds[i], quantization);
+                writer.WriteBool(changed);
+                if(!changed)
+                    continue;
+            }
+
+            writer.WriteBits(value, FieldBits(FieldKinds[i], quantization));
+        }
+    }
+
+    bool ControllerSnapshotSerializer::Deserialize(ControllerSnapshot& snapshot, const ControllerSnapshot* baseline,
+        const SnapshotQuantization& quantization, BitReader& reader)
+    {
+        const SnapshotFields baselineFields = baseline != nullptr ? ToFields(*baseline) : SnapshotFields{};
+        SnapshotFields fields;
+
+        for(AZ::u8 i = 0; i < FieldCount; ++i)
+        {
+            AZ::u32 value = 0;
+            if(baseline != nullptr && !reader.ReadBool())
+                value = QuantizeField(baselineFields[i], FieldKinds[i], quantization);
+            else
+                value = reader.ReadBits(FieldBits(FieldKinds[i], quantization));
+
+            fields[i] = DequantizeField(value, FieldKinds[i], quantization);
+        }
+
+        if(reader.IsOverflowed())
+            return false;
+
+        snapshot = FromFields(fields);
+        return true;
+    }
+
+    ControllerSnapshot ControllerSnapshotSerializer::Quantize(const ControllerSnapshot& snapshot, const SnapshotQuantization& quantization)
+    {
+        SnapshotFields fields = ToFields(snapshot);
+        for(AZ::u8 i = 0; i < FieldCount; ++i)
+            fields[i] = DequantizeField(QuantizeField(fields[i], FieldKinds[i], quantization), FieldKinds[i], quantization);
+        return FromFields(fields);
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,94 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace FirstPersonController
+{
+    // The controller's input values and movement state, as replicated or recorded
+    struct ControllerSnapshot
+    {
+        float m_forwardValue = 0.f;
+        float m_backValue = 0.f;
+        float m_leftValue = 0.f;
+        float m_rightValue = 0.f;
+        float m_yawValue = 0.f;
+        float m_pitchValue = 0.f;
+        float m_sprintValue = 0.f;
+        float m_crouchValue = 0.f;
+        float m_jumpValue = 0.f;
+        float m_heading = 0.f;
+        float m_pitch = 0.f;
+        AZ::Vector2 m_applyVelocityXY = AZ::Vector2::CreateZero();
+        float m_applyVelocityZ = 0.f;
+    };
+
+    // Number of bits and range used for each kind of field, values outside of a range are clamped
+    struct SnapshotQuantization
+    {
+        // Forward, back, left, right, sprint, crouch and jump input values within [-1, 1]
+        AZ::u8 m_inputValueBits = 8;
+        // Yaw and pitch input values within +/- m_rotationInputRange
+        AZ::u8 m_rotationInputBits = 16;
+        float m_rotationInputRange = 512.f;
+        // Heading and pitch angles, wrapped to [-pi, pi)
+        AZ::u8 m_angleBits = 16;
+        // Apply velocity X, Y and Z within +/- m_velocityRange (m/s)
+        AZ::u8 m_velocityBits = 16;
+        float m_velocityRange = 64.f;
+    };
+
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(AZStd::vector<AZ::u8>& buffer);
+
+        void WriteBits(AZ::u32 value, AZ::u8 bitCount);
+        void WriteBool(bool value);
+
+        AZ::u32 GetBitCount() const;
+
+    private:
+        AZStd::vector<AZ::u8>& m_buffer;
+        AZ::u32 m_bitCount = 0;
+    };
+
+    class BitReader
+    {
+    public:
+        BitReader(const AZ::u8* data, AZ::u32 byteCount);
+
+        AZ::u32 ReadBits(AZ::u8 bitCount);
+        bool ReadBool();
+
+        // True once a read went past the end of the data, every read after that returns zero
+        bool IsOverflowed() const;
+
+    private:
+        const AZ::u8* m_data = nullptr;
+        AZ::u32 m_bitSize = 0;
+        AZ::u32 m_bitPosition = 0;
+        bool m_overflowed = false;
+    };
+
+    // Bit-packs controller snapshots. When a baseline is given only the fields whose quantized value
+    // differs from the baseline's are written, preceded by one changed bit per field. The same
+    // baseline and quantization must be used to read the snapshot back.
+    class ControllerSnapshotSerializer
+    {
+    public:
+        static void Serialize(const ControllerSnapshot& snapshot, const ControllerSnapshot* baseline,
+            const SnapshotQuantization& quantization, BitWriter& writer);
+        static bool Deserialize(ControllerSnapshot& snapshot, const ControllerSnapshot* baseline,
+            const SnapshotQuantization& quantization, BitReader& reader);
+
+        // Returns the snapshot as the receiving side reconstructs it
+        static ControllerSnapshot Quantize(const ControllerSnapshot& snapshot, const SnapshotQuantization& quantization);
+
+        static constexpr AZ::u8 FieldCount = 14;
+    };
+} // namespace FirstPersonController
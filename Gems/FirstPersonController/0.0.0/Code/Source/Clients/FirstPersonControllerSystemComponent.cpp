@@ -7,6 +7,8 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Math/MathUtils.h>
 
 namespace FirstPersonController
 {
@@ -27,6 +29,55 @@ namespace FirstPersonController
                     ;
             }
         }
+
+        if (AZ::BehaviorContext* bc = azrtti_cast<AZ::BehaviorContext*>(context))
+        {
+            bc->EBus<FirstPersonControllerRequestBus>("FirstPersonControllerRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Get LOD Tier Controller Counts", &FirstPersonControllerRequests::GetLodTierControllerCounts)
+                ->Event("Get LOD Tier Step Counts", &FirstPersonControllerRequests::GetLodTierStepCounts)
+                ->Event("Get Kinematic Mover Count", &FirstPersonControllerRequests::GetKinematicMoverCount)
+                ->Event("Get Active Kinematic Mover Count", &FirstPersonControllerRequests::GetActiveKinematicMoverCount)
+                ->Event("Get Parallel Scene Stepping", &FirstPersonControllerRequests::GetParallelSceneStepping)
+                ->Event("Set Parallel Scene Stepping", &FirstPersonControllerRequests::SetParallelSceneStepping)
+                ->Event("Get Controllers Per Job", &FirstPersonControllerRequests::GetControllersPerJob)
+                ->Event("Set Controllers Per Job", &FirstPersonControllerRequests::SetControllersPerJob)
+                ->Event("Get Last Query Phase Microseconds", &FirstPersonControllerRequests::GetLastQueryPhaseMicroseconds)
+                ->Event("Get Last Serial Phase Microseconds", &FirstPersonControllerRequests::GetLastSerialPhaseMicroseconds)
+                ->Event("Get Stepped Scene Count", &FirstPersonControllerRequests::GetSteppedSceneCount)
+                ->Event("Get Stepped Controller Count", &FirstPersonControllerRequests::GetSteppedControllerCount);
+
+            bc->EBus<InteractableRegistryRequestBus>("InteractableRegistryRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Query Interactables In Radius", &InteractableRegistryRequests::QueryInteractablesInRadius)
+                ->Event("Query Interactables In Cone", &InteractableRegistryRequests::QueryInteractablesInCone)
+                ->Event("Get Interactable Count", &InteractableRegistryRequests::GetInteractableCount);
+
+            bc->EBus<TagIndexRequestBus>("TagIndexRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Track Tag", &TagIndexRequests::TrackTagByName)
+                ->Event("Entity Has Tag (Cached)", &TagIndexRequests::EntityHasTagByName)
+                ->Event("Get Entities By Tag (Cached)", &TagIndexRequests::GetEntitiesByTagName)
+                ->Event("Get First Entity By Tag (Cached)", &TagIndexRequests::GetFirstEntityByTagName)
+                ->Event("Get Entity Tag Mask", &TagIndexRequests::GetEntityTagMask);
+
+            bc->EBus<CharacterTeleportRequestBus>("CharacterTeleportRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Teleport", &CharacterTeleportRequests::Teleport)
+                ->Event("Teleport Many", &CharacterTeleportRequests::TeleportMany)
+                ->Event("Get Teleport Probe Height", &CharacterTeleportRequests::GetTeleportProbeHeight)
+                ->Event("Set Teleport Probe Height", &CharacterTeleportRequests::SetTeleportProbeHeight)
+                ->Event("Get Teleport Skin Width", &CharacterTeleportRequests::GetTeleportSkinWidth)
+                ->Event("Set Teleport Skin Width", &CharacterTeleportRequests::SetTeleportSkinWidth);
+        }
     }
 
     void FirstPersonControllerSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
@@ -53,6 +104,18 @@ namespace FirstPersonController
         {
             FirstPersonControllerInterface::Register(this);
         }
+        if (InteractableRegistryInterface::Get() == nullptr)
+        {
+            InteractableRegistryInterface::Register(this);
+        }
+        if (TagIndexInterface::Get() == nullptr)
+        {
+            TagIndexInterface::Register(this);
+        }
+        if (CharacterTeleportInterface::Get() == nullptr)
+        {
+            CharacterTeleportInterface::Register(this);
+        }
     }
 
     FirstPersonControllerSystemComponent::~FirstPersonControllerSystemComponent()
@@ -61,6 +124,18 @@ namespace FirstPersonController
         {
             FirstPersonControllerInterface::Unregister(this);
         }
+        if (InteractableRegistryInterface::Get() == this)
+        {
+            InteractableRegistryInterface::Unregister(this);
+        }
+        if (TagIndexInterface::Get() == this)
+        {
+            TagIndexInterface::Unregister(this);
+        }
+        if (CharacterTeleportInterface::Get() == this)
+        {
+            CharacterTeleportInterface::Unregister(this);
+        }
     }
 
     void FirstPersonControllerSystemComponent::Init()
@@ -70,17 +145,232 @@ namespace FirstPersonController
     void FirstPersonControllerSystemComponent::Activate()
     {
         FirstPersonControllerRequestBus::Handler::BusConnect();
+        InteractableRegistryRequestBus::Handler::BusConnect();
+        TagIndexRequestBus::Handler::BusConnect();
+        CharacterTeleportRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
     }
 
     void FirstPersonControllerSystemComponent::Deactivate()
     {
         AZ::TickBus::Handler::BusDisconnect();
+        CharacterTeleportRequestBus::Handler::BusDisconnect();
+        TagIndexRequestBus::Handler::BusDisconnect();
+        InteractableRegistryRequestBus::Handler::BusDisconnect();
         FirstPersonControllerRequestBus::Handler::BusDisconnect();
+        m_interactableGrid.Clear();
+        m_tagIndex.Clear();
+        m_kinematicMovers.Clear();
+        m_controllerSteps.Clear();
+    }
+
+    void FirstPersonControllerSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        // Publish the LOD tier counts gathered over the last tick and start counting again
+        for (AZ::u8 tier = 0; tier < static_cast<AZ::u8>(LodTier::Count); ++tier)
+        {
+            m_lodTierControllers[tier] = m_lodTierControllersAccum[tier];
+            m_lodTierSteps[tier] = m_lodTierStepsAccum[tier];
+            m_lodTierControllersAccum[tier] = 0;
+            m_lodTierStepsAccum[tier] = 0;
+        }
+
+        m_controllerSteps.Tick(deltaTime);
+    }
+
+    void FirstPersonControllerSystemComponent::ReportLodTier(const LodTier& tier)
+    {
+        const AZ::u8 index = static_cast<AZ::u8>(tier);
+        if (index < static_cast<AZ::u8>(LodTier::Count))
+        {
+            ++m_lodTierControllersAccum[index];
+        }
+    }
+
+    void FirstPersonControllerSystemComponent::ReportLodStep(const LodTier& tier)
+    {
+        const AZ::u8 index = static_cast<AZ::u8>(tier);
+        if (index < static_cast<AZ::u8>(LodTier::Count))
+        {
+            ++m_lodTierStepsAccum[index];
+        }
+    }
+
+    AZStd::vector<AZ::u32> FirstPersonControllerSystemComponent::GetLodTierControllerCounts() const
+    {
+        return AZStd::vector<AZ::u32>(AZStd::begin(m_lodTierControllers), AZStd::end(m_lodTierControllers));
+    }
+
+    AZStd::vector<AZ::u32> FirstPersonControllerSystemComponent::GetLodTierStepCounts() const
+    {
+        return AZStd::vector<AZ::u32>(AZStd::begin(m_lodTierSteps), AZStd::end(m_lodTierSteps));
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetKinematicMoverCount() const
+    {
+        return m_kinematicMovers.GetMoverCount();
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetActiveKinematicMoverCount() const
+    {
+        return m_kinematicMovers.GetActiveMoverCount();
+    }
+
+    bool FirstPersonControllerSystemComponent::GetParallelSceneStepping() const
+    {
+        return m_controllerSteps.GetParallelSceneStepping();
+    }
+
+    void FirstPersonControllerSystemComponent::SetParallelSceneStepping(const bool& parallelSceneStepping)
+    {
+        m_controllerSteps.SetParallelSceneStepping(parallelSceneStepping);
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetControllersPerJob() const
+    {
+        return m_controllerSteps.GetControllersPerJob();
+    }
+
+    void FirstPersonControllerSystemComponent::SetControllersPerJob(const AZ::u32& controllersPerJob)
+    {
+        m_controllerSteps.SetControllersPerJob(controllersPerJob);
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetLastQueryPhaseMicroseconds() const
+    {
+        return m_controllerSteps.GetLastQueryPhaseMicroseconds();
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetLastSerialPhaseMicroseconds() const
+    {
+        return m_controllerSteps.GetLastSerialPhaseMicroseconds();
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetSteppedSceneCount() const
+    {
+        return m_controllerSteps.GetSceneCount();
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetSteppedControllerCount() const
+    {
+        return m_controllerSteps.GetControllerCount();
+    }
+
+    void FirstPersonControllerSystemComponent::RegisterInteractable(const AZ::EntityId& entityId, const AZ::Vector3& position)
+    {
+        m_interactableGrid.Insert(entityId, position);
+    }
+
+    void FirstPersonControllerSystemComponent::UnregisterInteractable(const AZ::EntityId& entityId)
+    {
+        m_interactableGrid.Remove(entityId);
+    }
+
+    AZStd::vector<AZ::EntityId> FirstPersonControllerSystemComponent::QueryInteractablesInRadius(const AZ::Vector3& center, const float& radius) const
+    {
+        AZStd::vector<AZ::EntityId> results;
+        m_interactableGrid.QueryRadius(center, radius, results);
+        return results;
+    }
+
+    AZStd::vector<AZ::EntityId> FirstPersonControllerSystemComponent::QueryInteractablesInCone(
+        const AZ::Vector3& origin, const AZ::Vector3& direction, const float& maxDistance, const float& halfAngleDegrees) const
+    {
+        AZStd::vector<AZ::EntityId> results;
+        if (direction.IsZero())
+        {
+            return results;
+        }
+        m_interactableGrid.QueryCone(origin, direction.GetNormalized(), maxDistance, AZ::DegToRad(halfAngleDegrees), results);
+        return results;
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetInteractableCount() const
+    {
+        return m_interactableGrid.GetCount();
+    }
+
+    void FirstPersonControllerSystemComponent::TrackTag(const AZ::Crc32& tag)
+    {
+        m_tagIndex.TrackTag(tag);
+    }
+
+    bool FirstPersonControllerSystemComponent::EntityHasTag(const AZ::EntityId& entityId, const AZ::Crc32& tag)
+    {
+        return m_tagIndex.HasTag(entityId, tag);
+    }
+
+    AZStd::vector<AZ::EntityId> FirstPersonControllerSystemComponent::GetEntitiesByTag(const AZ::Crc32& tag)
+    {
+        const AZStd::unordered_set<AZ::EntityId>& entityIds = m_tagIndex.GetEntities(tag);
+        return AZStd::vector<AZ::EntityId>(entityIds.begin(), entityIds.end());
+    }
+
+    AZ::EntityId FirstPersonControllerSystemComponent::GetFirstEntityByTag(const AZ::Crc32& tag)
+    {
+        const AZStd::unordered_set<AZ::EntityId>& entityIds = m_tagIndex.GetEntities(tag);
+        return entityIds.empty() ? AZ::EntityId() : *entityIds.begin();
+    }
+
+    AZ::u64 FirstPersonControllerSystemComponent::GetEntityTagMask(const AZ::EntityId& entityId) const
+    {
+        return m_tagIndex.GetEntityTagMask(entityId);
+    }
+
+    AZ::u64 FirstPersonControllerSystemComponent::GetTagBit(const AZ::Crc32& tag)
+    {
+        return m_tagIndex.GetTagBit(tag);
+    }
+
+    void FirstPersonControllerSystemComponent::TrackTagByName(const AZStd::string& tagName)
+    {
+        TrackTag(AZ::Crc32(tagName));
+    }
+
+    bool FirstPersonControllerSystemComponent::EntityHasTagByName(const AZ::EntityId& entityId, const AZStd::string& tagName)
+    {
+        return EntityHasTag(entityId, AZ::Crc32(tagName));
+    }
+
+    AZStd::vector<AZ::EntityId> FirstPersonControllerSystemComponent::GetEntitiesByTagName(const AZStd::string& tagName)
+    {
+        return GetEntitiesByTag(AZ::Crc32(tagName));
+    }
+
+    AZ::EntityId FirstPersonControllerSystemComponent::GetFirstEntityByTagName(const AZStd::string& tagName)
+    {
+        return GetFirstEntityByTag(AZ::Crc32(tagName));
+    }
+
+    bool FirstPersonControllerSystemComponent::Teleport(const AZ::EntityId& entityId, const AZ::Vector3& position)
+    {
+        return !m_characterTeleporter.TeleportMany({ entityId }, { position }).empty();
+    }
+
+    AZStd::vector<AZ::EntityId> FirstPersonControllerSystemComponent::TeleportMany(
+        const AZStd::vector<AZ::EntityId>& entityIds, const AZStd::vector<AZ::Vector3>& positions)
+    {
+        return m_characterTeleporter.TeleportMany(entityIds, positions);
+    }
+
+    float FirstPersonControllerSystemComponent::GetTeleportProbeHeight() const
+    {
+        return m_characterTeleporter.GetProbeHeight();
+    }
+
+    void FirstPersonControllerSystemComponent::SetTeleportProbeHeight(const float& probeHeight)
+    {
+        m_characterTeleporter.SetProbeHeight(probeHeight);
+    }
+
+    float FirstPersonControllerSystemComponent::GetTeleportSkinWidth() const
+    {
+        return m_characterTeleporter.GetSkinWidth();
     }
 
-    void FirstPersonControllerSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    void FirstPersonControllerSystemComponent::SetTeleportSkinWidth(const float& skinWidth)
     {
+        m_characterTeleporter.SetSkinWidth(skinWidth);
     }
 
 } // namespace FirstPersonController
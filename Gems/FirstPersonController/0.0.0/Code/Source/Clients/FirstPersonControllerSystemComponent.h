@@ -6,13 +6,25 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <FirstPersonController/CharacterTeleportBus.h>
 #include <FirstPersonController/FirstPersonControllerBus.h>
+#include <FirstPersonController/InteractableRegistryBus.h>
+#include <FirstPersonController/TagIndexBus.h>
+
+#include <Clients/CharacterTeleporter.h>
+#include <Clients/ControllerStepScheduler.h>
+#include <Clients/InteractableSpatialGrid.h>
+#include <Clients/KinematicMoverSystem.h>
+#include <Clients/TagIndex.h>
 
 namespace FirstPersonController
 {
     class FirstPersonControllerSystemComponent
         : public AZ::Component
         , protected FirstPersonControllerRequestBus::Handler
+        , protected InteractableRegistryRequestBus::Handler
+        , protected TagIndexRequestBus::Handler
+        , protected CharacterTeleportRequestBus::Handler
         , public AZ::TickBus::Handler
     {
     public:
@@ -31,7 +43,54 @@ namespace FirstPersonController
     protected:
         ////////////////////////////////////////////////////////////////////////
         // FirstPersonControllerRequestBus interface implementation
+        void ReportLodTier(const LodTier& tier) override;
+        void ReportLodStep(const LodTier& tier) override;
+        AZStd::vector<AZ::u32> GetLodTierControllerCounts() const override;
+        AZStd::vector<AZ::u32> GetLodTierStepCounts() const override;
+        AZ::u32 GetKinematicMoverCount() const override;
+        AZ::u32 GetActiveKinematicMoverCount() const override;
+        bool GetParallelSceneStepping() const override;
+        void SetParallelSceneStepping(const bool& parallelSceneStepping) override;
+        AZ::u32 GetControllersPerJob() const override;
+        void SetControllersPerJob(const AZ::u32& controllersPerJob) override;
+        AZ::u32 GetLastQueryPhaseMicroseconds() const override;
+        AZ::u32 GetLastSerialPhaseMicroseconds() const override;
+        AZ::u32 GetSteppedSceneCount() const override;
+        AZ::u32 GetSteppedControllerCount() const override;
+        ////////////////////////////////////////////////////////////////////////
+
+        ////////////////////////////////////////////////////////////////////////
+        // InteractableRegistryRequestBus interface implementation
+        void RegisterInteractable(const AZ::EntityId& entityId, const AZ::Vector3& position) override;
+        void UnregisterInteractable(const AZ::EntityId& entityId) override;
+        AZStd::vector<AZ::EntityId> QueryInteractablesInRadius(const AZ::Vector3& center, const float& radius) const override;
+        AZStd::vector<AZ::EntityId> QueryInteractablesInCone(
+            const AZ::Vector3& origin, const AZ::Vector3& direction, const float& maxDistance, const float& halfAngleDegrees) const override;
+        AZ::u32 GetInteractableCount() const override;
+        ////////////////////////////////////////////////////////////////////////
 
+        ////////////////////////////////////////////////////////////////////////
+        // TagIndexRequestBus interface implementation
+        void TrackTag(const AZ::Crc32& tag) override;
+        bool EntityHasTag(const AZ::EntityId& entityId, const AZ::Crc32& tag) override;
+        AZStd::vector<AZ::EntityId> GetEntitiesByTag(const AZ::Crc32& tag) override;
+        AZ::EntityId GetFirstEntityByTag(const AZ::Crc32& tag) override;
+        AZ::u64 GetEntityTagMask(const AZ::EntityId& entityId) const override;
+        AZ::u64 GetTagBit(const AZ::Crc32& tag) override;
+        void TrackTagByName(const AZStd::string& tagName) override;
+        bool EntityHasTagByName(const AZ::EntityId& entityId, const AZStd::string& tagName) override;
+        AZStd::vector<AZ::EntityId> GetEntitiesByTagName(const AZStd::string& tagName) override;
+        AZ::EntityId GetFirstEntityByTagName(const AZStd::string& tagName) override;
+        ////////////////////////////////////////////////////////////////////////
+
+        ////////////////////////////////////////////////////////////////////////
+        // CharacterTeleportRequestBus interface implementation
+        bool Teleport(const AZ::EntityId& entityId, const AZ::Vector3& position) override;
+        AZStd::vector<AZ::EntityId> TeleportMany(const AZStd::vector<AZ::EntityId>& entityIds, const AZStd::vector<AZ::Vector3>& positions) override;
+        float GetTeleportProbeHeight() const override;
+        void SetTeleportProbeHeight(const float& probeHeight) override;
+        float GetTeleportSkinWidth() const override;
+        void SetTeleportSkinWidth(const float& skinWidth) override;
         ////////////////////////////////////////////////////////////////////////
 
         ////////////////////////////////////////////////////////////////////////
@@ -45,6 +104,28 @@ namespace FirstPersonController
         // AZTickBus interface implementation
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         ////////////////////////////////////////////////////////////////////////
+
+    private:
+        // LOD tier counters, accumulated during the current tick and published on the next system tick
+        AZ::u32 m_lodTierControllersAccum[static_cast<AZ::u8>(LodTier::Count)] = {0, 0, 0};
+        AZ::u32 m_lodTierStepsAccum[static_cast<AZ::u8>(LodTier::Count)] = {0, 0, 0};
+        AZ::u32 m_lodTierControllers[static_cast<AZ::u8>(LodTier::Count)] = {0, 0, 0};
+        AZ::u32 m_lodTierSteps[static_cast<AZ::u8>(LodTier::Count)] = {0, 0, 0};
+
+        // Positions of the registered interactables
+        InteractableSpatialGrid m_interactableGrid;
+
+        // Cached tag lookups
+        TagIndex m_tagIndex;
+
+        // Elevators, doors and platforms stepped together each physics step
+        KinematicMoverSystem m_kinematicMovers;
+
+        // Sweep and overlap validated character teleports
+        CharacterTeleporter m_characterTeleporter;
+
+        // First Person Controllers stepped together, grouped by their physics scene
+        ControllerStepScheduler m_controllerSteps;
     };
 
 } // namespace FirstPersonController
@@ -0,0 +1,408 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/FirstPersonInteractionComponent.h>
+#include <Clients/PhysicsSceneLookup.h>
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include <AzFramework/Physics/CollisionBus.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+
+#include <FirstPersonController/TagIndexBus.h>
+
+#include <LmbrCentral/Scripting/TagComponentBus.h>
+
+namespace FirstPersonController
+{
+    using namespace StartingPointInput;
+
+    void FirstPersonInteractionComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<FirstPersonInteractionComponent, AZ::Component>()
+              ->Field("Interact Key", &FirstPersonInteractionComponent::m_strInteract)
+              ->Field("Interactable Tag", &FirstPersonInteractionComponent::m_interactableTag)
+              ->Field("Interact Distance (m)", &FirstPersonInteractionComponent::m_interactDistance)
+              ->Field("Interact Collision Group", &FirstPersonInteractionComponent::m_interactCollisionGroupId)
+              ->Field("Cast Tick Interval", &FirstPersonInteractionComponent::m_castTickInterval)
+              ->Field("Interact Hold Time (s)", &FirstPersonInteractionComponent::m_interactHoldTime)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Class<FirstPersonInteractionComponent>("First Person Interaction",
+                    "Detects the interactable entity in front of the active camera and notifies on focus changes and interactions")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller")
+                    ->DataElement(nullptr,
+                        &FirstPersonInteractionComponent::m_strInteract,
+                        "Interact Key", "Key for interacting with the focused entity. Must match an Event Name in the .inputbindings file.")
+                    ->DataElement(nullptr,
+                        &FirstPersonInteractionComponent::m_interactableTag,
+                        "Interactable Tag", "Only entities with this tag can be focused and interacted with.")
+                    ->DataElement(nullptr,
+                        &FirstPersonInteractionComponent::m_interactDistance,
+                        "Interact Distance (m)", "Determines how far in front of the camera an entity can be interacted with.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonInteractionComponent::m_interactCollisionGroupId,
+                        "Interact Collision Group", "The collision group which will be used for the interaction ray cast.")
+                    ->DataElement(nullptr,
+                        &FirstPersonInteractionComponent::m_castTickInterval,
+                        "Cast Tick Interval", "Number of ticks between interaction ray casts. Increasing this reduces the cost at the expense of responsiveness.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(nullptr,
+                        &FirstPersonInteractionComponent::m_interactHoldTime,
+                        "Interact Hold Time (s)", "How long the interact key must be held to interact. A value of zero interacts on press, otherwise progress is reported while the key is held.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f);
+            }
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->EBus<InteractionNotificationBus>("InteractionNotificationBus")
+                ->Handler<InteractionNotificationHandler>();
+
+            bc->EBus<FirstPersonInteractionComponentRequestBus>("FirstPersonInteractionComponentRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Get Focused EntityId", &FirstPersonInteractionComponentRequests::GetFocusedEntityId)
+                ->Event("Interact", &FirstPersonInteractionComponentRequests::Interact)
+                ->Event("Get Interact Distance", &FirstPersonInteractionComponentRequests::GetInteractDistance)
+                ->Event("Set Interact Distance", &FirstPersonInteractionComponentRequests::SetInteractDistance)
+                ->Event("Get Interactable Tag", &FirstPersonInteractionComponentRequests::GetInteractableTag)
+                ->Event("Set Interactable Tag", &FirstPersonInteractionComponentRequests::SetInteractableTag)
+                ->Event("Get Cast Tick Interval", &FirstPersonInteractionComponentRequests::GetCastTickInterval)
+                ->Event("Set Cast Tick Interval", &FirstPersonInteractionComponentRequests::SetCastTickInterval)
+                ->Event("Get Interact Event Name", &FirstPersonInteractionComponentRequests::GetInteractEventName)
+                ->Event("Set Interact Event Name", &FirstPersonInteractionComponentRequests::SetInteractEventName)
+                ->Event("Get Interact Collision Group Name", &FirstPersonInteractionComponentRequests::GetInteractCollisionGroupName)
+                ->Event("Set Interact Collision Group", &FirstPersonInteractionComponentRequests::SetInteractCollisionGroupByName)
+                ->Event("Get Interact Hold Time", &FirstPersonInteractionComponentRequests::GetInteractHoldTime)
+                ->Event("Set Interact Hold Time", &FirstPersonInteractionComponentRequests::SetInteractHoldTime)
+                ->Event("Get Interact Progress", &FirstPersonInteractionComponentRequests::GetInteractProgress)
+                ->Event("Get Interaction Events Per Second", &FirstPersonInteractionComponentRequests::GetInteractionEventsPerSecond)
+                ->Event("Get Per Tick Equivalent Events Per Second", &FirstPersonInteractionComponentRequests::GetPerTickEquivalentEventsPerSecond);
+
+            bc->Class<FirstPersonInteractionComponent>()->RequestBus("FirstPersonInteractionComponentRequestBus");
+        }
+    }
+
+    void FirstPersonInteractionComponent::Activate()
+    {
+        Physics::CollisionRequestBus::BroadcastResult(
+            m_interactCollisionGroup, &Physics::CollisionRequests::GetCollisionGroupById, m_interactCollisionGroupId);
+
+        m_interactableTagCrc = AZ::Crc32(m_interactableTag);
+
+        // The interaction ray is cast in the scene the character queries
+        m_sceneHandle = GetEntityPhysicsScene(GetEntityId());
+
+        // The active camera is cached and only updated when the active view changes
+        Camera::CameraSystemRequestBus::BroadcastResult(m_activeCameraEntityId,
+            &Camera::CameraSystemRequestBus::Events::GetActiveCamera);
+        Camera::CameraNotificationBus::Handler::BusConnect();
+
+        ConnectInteractEvent();
+
+        AZ::TickBus::Handler::BusConnect();
+        FirstPersonInteractionComponentRequestBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void FirstPersonInteractionComponent::Deactivate()
+    {
+        SetFocusedEntityId(AZ::EntityId());
+
+        AZ::TickBus::Handler::BusDisconnect();
+        Camera::CameraNotificationBus::Handler::BusDisconnect();
+        InputEventNotificationBus::Handler::BusDisconnect();
+        FirstPersonInteractionComponentRequestBus::Handler::BusDisconnect();
+
+        m_sceneHandle = AzPhysics::InvalidSceneHandle;
+        m_interactHold.Release();
+        m_interactionEventsAccum = 0;
+        m_perTickEventsAccum = 0;
+        m_interactionEventsPerSecond = 0;
+        m_perTickEventsPerSecond = 0;
+        m_eventWindowTime = 0.f;
+    }
+
+    void FirstPersonInteractionComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("FirstPersonControllerService"));
+        required.push_back(AZ_CRC_CE("TransformService"));
+    }
+
+    void FirstPersonInteractionComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("FirstPersonInteractionService"));
+    }
+
+    void FirstPersonInteractionComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("FirstPersonInteractionService"));
+    }
+
+    void FirstPersonInteractionComponent::ConnectInteractEvent()
+    {
+        // Disconnect prior to connecting since this may be a reassignment
+        InputEventNotificationBus::Handler::BusDisconnect();
+        InputEventNotificationBus::Handler::BusConnect(InputEventNotificationId(m_strInteract.c_str()));
+    }
+
+    void FirstPersonInteractionComponent::OnActiveViewChanged(const AZ::EntityId& activeEntityId)
+    {
+        m_activeCameraEntityId = activeEntityId;
+    }
+
+    void FirstPersonInteractionComponent::OnPressed([[maybe_unused]] float value)
+    {
+        if(m_interactHold.Press(m_interactHoldTime))
+            Interact();
+    }
+
+    void FirstPersonInteractionComponent::OnReleased([[maybe_unused]] float value)
+    {
+        m_interactHold.Release();
+        SetInteractProgress(0.f);
+    }
+
+    void FirstPersonInteractionComponent::OnTick(float deltaTime, AZ::ScriptTimePoint)
+    {
+        if(++m_ticksSinceCast >= m_castTickInterval)
+        {
+            m_ticksSinceCast = 0;
+            UpdateFocus();
+        }
+
+        UpdateInteractProgress(deltaTime);
+        UpdateEventCounters(deltaTime);
+    }
+
+    void FirstPersonInteractionComponent::UpdateInteractProgress(const float& deltaTime)
+    {
+        if(!m_interactHold.IsHeld() || !m_focusedEntityId.IsValid())
+            return;
+
+        const bool completed = m_interactHold.Update(deltaTime, m_interactHoldTime);
+        SetInteractProgress(m_interactHold.GetProgress());
+
+        // A completed hold needs a fresh press before it starts again, listeners are told the progress went back to zero
+        if(completed)
+        {
+            Interact();
+            m_interactHold.Release();
+            SetInteractProgress(0.f);
+        }
+    }
+
+    void FirstPersonInteractionComponent::SetInteractProgress(const float& progress)
+    {
+        if(progress == m_interactProgress)
+            return;
+
+        m_interactProgress = progress;
+        if(m_focusedEntityId.IsValid())
+        {
+            InteractionNotificationBus::Event(GetEntityId(),
+                &InteractionNotificationBus::Events::OnInteractProgress, m_focusedEntityId, m_interactProgress);
+            InteractionNotificationBus::Event(m_focusedEntityId,
+                &InteractionNotificationBus::Events::OnInteractProgress, GetEntityId(), m_interactProgress);
+            ++m_interactionEventsAccum;
+        }
+    }
+
+    void FirstPersonInteractionComponent::UpdateEventCounters(const float& deltaTime)
+    {
+        // A per-tick broadcast sends the hover state every tick for as long as something is focused
+        if(m_focusedEntityId.IsValid())
+            ++m_perTickEventsAccum;
+
+        m_eventWindowTime += deltaTime;
+        if(m_eventWindowTime < 1.f)
+            return;
+
+        m_interactionEventsPerSecond = static_cast<AZ::u32>(m_interactionEventsAccum / m_eventWindowTime);
+        m_perTickEventsPerSecond = static_cast<AZ::u32>(m_perTickEventsAccum / m_eventWindowTime);
+        m_interactionEventsAccum = 0;
+        m_perTickEventsAccum = 0;
+        m_eventWindowTime = 0.f;
+    }
+
+    void FirstPersonInteractionComponent::UpdateFocus()
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if(sceneInterface == nullptr || m_sceneHandle == AzPhysics::InvalidSceneHandle)
+            return;
+
+        AZ::Transform cameraTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(cameraTM, m_activeCameraEntityId, &AZ::TransformBus::Events::GetWorldTM);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = cameraTM.GetTranslation();
+        request.m_direction = cameraTM.GetBasisY().GetNormalized();
+        request.m_distance = m_interactDistance;
+        request.m_collisionGroup = m_interactCollisionGroup;
+        request.m_reportMultipleHits = true;
+
+        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(m_sceneHandle, &request);
+
+        // The camera sits inside the character's capsule, so the closest hit that isn't the character is used
+        const AzPhysics::SceneQueryHit* closestHit = nullptr;
+        for(const AzPhysics::SceneQueryHit& hit : hits.m_hits)
+        {
+            if(hit.m_entityId == GetEntityId() || hit.m_entityId == m_activeCameraEntityId)
+                continue;
+            if(closestHit == nullptr || hit.m_distance < closestHit->m_distance)
+                closestHit = &hit;
+        }
+
+        AZ::EntityId focusedEntityId;
+        if(closestHit != nullptr)
+        {
+            // The cached tag index avoids an EBus lookup on the hit entity each cast
+            bool hasTag = false;
+            if(auto* tagIndex = TagIndexInterface::Get())
+                hasTag = tagIndex->EntityHasTag(closestHit->m_entityId, m_interactableTagCrc);
+            else
+                LmbrCentral::TagComponentRequestBus::EventResult(hasTag, closestHit->m_entityId,
+                    &LmbrCentral::TagComponentRequests::HasTag, LmbrCentral::Tag(m_interactableTagCrc));
+            if(hasTag)
+                focusedEntityId = closestHit->m_entityId;
+        }
+
+        SetFocusedEntityId(focusedEntityId);
+    }
+
+    void FirstPersonInteractionComponent::SetFocusedEntityId(const AZ::EntityId& entityId)
+    {
+        // Notifications are only sent when the focus changes
+        if(entityId == m_focusedEntityId)
+            return;
+
+        // Progress made on the previous entity does not carry over, the entity losing focus is told its progress was reset
+        // and the interact key has to be pressed again before holding it counts toward the new entity
+        SetInteractProgress(0.f);
+        m_interactHold.Release();
+
+        const AZ::EntityId previousEntityId = m_focusedEntityId;
+        m_focusedEntityId = entityId;
+
+        if(previousEntityId.IsValid())
+        {
+            InteractionNotificationBus::Event(GetEntityId(),
+                &InteractionNotificationBus::Events::OnFocusLost, previousEntityId);
+            InteractionNotificationBus::Event(previousEntityId,
+                &InteractionNotificationBus::Events::OnFocusLost, GetEntityId());
+            ++m_interactionEventsAccum;
+        }
+        if(m_focusedEntityId.IsValid())
+        {
+            InteractionNotificationBus::Event(GetEntityId(),
+                &InteractionNotificationBus::Events::OnFocusGained, m_focusedEntityId);
+            InteractionNotificationBus::Event(m_focusedEntityId,
+                &InteractionNotificationBus::Events::OnFocusGained, GetEntityId());
+            ++m_interactionEventsAccum;
+        }
+    }
+
+    // Request Bus getter and setter methods for use in scripts
+    AZ::EntityId FirstPersonInteractionComponent::GetFocusedEntityId() const
+    {
+        return m_focusedEntityId;
+    }
+    void FirstPersonInteractionComponent::Interact()
+    {
+        if(!m_focusedEntityId.IsValid())
+            return;
+
+        InteractionNotificationBus::Event(GetEntityId(),
+            &InteractionNotificationBus::Events::OnInteract, m_focusedEntityId);
+        InteractionNotificationBus::Event(m_focusedEntityId,
+            &InteractionNotificationBus::Events::OnInteract, GetEntityId());
+        ++m_interactionEventsAccum;
+        ++m_perTickEventsAccum;
+    }
+    float FirstPersonInteractionComponent::GetInteractDistance() const
+    {
+        return m_interactDistance;
+    }
+    void FirstPersonInteractionComponent::SetInteractDistance(const float& new_interactDistance)
+    {
+        m_interactDistance = AZ::GetMax(new_interactDistance, 0.f);
+    }
+    AZStd::string FirstPersonInteractionComponent::GetInteractableTag() const
+    {
+        return m_interactableTag;
+    }
+    void FirstPersonInteractionComponent::SetInteractableTag(const AZStd::string& new_interactableTag)
+    {
+        m_interactableTag = new_interactableTag;
+        m_interactableTagCrc = AZ::Crc32(m_interactableTag);
+    }
+    AZ::u32 FirstPersonInteractionComponent::GetCastTickInterval() const
+    {
+        return m_castTickInterval;
+    }
+    void FirstPersonInteractionComponent::SetCastTickInterval(const AZ::u32& new_castTickInterval)
+    {
+        m_castTickInterval = AZ::GetMax(new_castTickInterval, 1u);
+    }
+    AZStd::string FirstPersonInteractionComponent::GetInteractEventName() const
+    {
+        return m_strInteract;
+    }
+    void FirstPersonInteractionComponent::SetInteractEventName(const AZStd::string& new_strInteract)
+    {
+        m_strInteract = new_strInteract;
+        ConnectInteractEvent();
+    }
+    AZStd::string FirstPersonInteractionComponent::GetInteractCollisionGroupName() const
+    {
+        AZStd::string groupName;
+        Physics::CollisionRequestBus::BroadcastResult(
+            groupName, &Physics::CollisionRequests::GetCollisionGroupName, m_interactCollisionGroup);
+        return groupName;
+    }
+    void FirstPersonInteractionComponent::SetInteractCollisionGroupByName(const AZStd::string& new_interactCollisionGroupName)
+    {
+        bool success = false;
+        AzPhysics::CollisionGroup collisionGroup;
+        Physics::CollisionRequestBus::BroadcastResult(success, &Physics::CollisionRequests::TryGetCollisionGroupByName, new_interactCollisionGroupName, collisionGroup);
+        if(success)
+        {
+            m_interactCollisionGroup = collisionGroup;
+            const AzPhysics::CollisionConfiguration& configuration = AZ::Interface<AzPhysics::SystemInterface>::Get()->GetConfiguration()->m_collisionConfig;
+            m_interactCollisionGroupId = configuration.m_collisionGroups.FindGroupIdByName(new_interactCollisionGroupName);
+        }
+    }
+    float FirstPersonInteractionComponent::GetInteractHoldTime() const
+    {
+        return m_interactHoldTime;
+    }
+    void FirstPersonInteractionComponent::SetInteractHoldTime(const float& new_interactHoldTime)
+    {
+        m_interactHoldTime = AZ::GetMax(new_interactHoldTime, 0.f);
+    }
+    float FirstPersonInteractionComponent::GetInteractProgress() const
+    {
+        return m_interactProgress;
+    }
+    AZ::u32 FirstPersonInteractionComponent::GetInteractionEventsPerSecond() const
+    {
+        return m_interactionEventsPerSecond;
+    }
+    AZ::u32 FirstPersonInteractionComponent::GetPerTickEquivalentEventsPerSecond() const
+    {
+        return m_perTickEventsPerSecond;
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,104 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+#include <FirstPersonController/FirstPersonInteractionComponentBus.h>
+
+#include <Clients/InteractHold.h>
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+
+#include <AzFramework/Components/CameraBus.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+
+#include <StartingPointInput/InputEventNotificationBus.h>
+
+namespace FirstPersonController
+{
+    class FirstPersonInteractionComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public Camera::CameraNotificationBus::Handler
+        , public StartingPointInput::InputEventNotificationBus::Handler
+        , public FirstPersonInteractionComponentRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(FirstPersonInteractionComponent, "{a93e5b21-7c4d-4f86-8e0a-2b6f19d7c3e4}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // TickBus interface
+        void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
+
+        // Camera::CameraNotificationBus
+        void OnActiveViewChanged(const AZ::EntityId& activeEntityId) override;
+
+        // AZ::InputEventNotificationBus interface
+        void OnPressed(float value) override;
+        void OnReleased(float value) override;
+
+        // FirstPersonInteractionComponentRequestBus
+        AZ::EntityId GetFocusedEntityId() const override;
+        void Interact() override;
+        float GetInteractDistance() const override;
+        void SetInteractDistance(const float& new_interactDistance) override;
+        AZStd::string GetInteractableTag() const override;
+        void SetInteractableTag(const AZStd::string& new_interactableTag) override;
+        AZ::u32 GetCastTickInterval() const override;
+        void SetCastTickInterval(const AZ::u32& new_castTickInterval) override;
+        AZStd::string GetInteractEventName() const override;
+        void SetInteractEventName(const AZStd::string& new_strInteract) override;
+        AZStd::string GetInteractCollisionGroupName() const override;
+        void SetInteractCollisionGroupByName(const AZStd::string& new_interactCollisionGroupName) override;
+        float GetInteractHoldTime() const override;
+        void SetInteractHoldTime(const float& new_interactHoldTime) override;
+        float GetInteractProgress() const override;
+        AZ::u32 GetInteractionEventsPerSecond() const override;
+        AZ::u32 GetPerTickEquivalentEventsPerSecond() const override;
+
+    private:
+        // Casts from the active camera along its forward axis and updates the focused entity
+        void UpdateFocus();
+        void SetFocusedEntityId(const AZ::EntityId& entityId);
+        void ConnectInteractEvent();
+        void UpdateInteractProgress(const float& deltaTime);
+        void SetInteractProgress(const float& progress);
+        void UpdateEventCounters(const float& deltaTime);
+
+        // Interaction settings
+        float m_interactDistance = 3.f;
+        AZStd::string m_interactableTag = "Use";
+        AZ::u32 m_castTickInterval = 1;
+        AZStd::string m_strInteract = "Use";
+        AzPhysics::CollisionGroups::Id m_interactCollisionGroupId = AzPhysics::CollisionGroups::Id();
+        AzPhysics::CollisionGroup m_interactCollisionGroup = AzPhysics::CollisionGroup::All;
+        float m_interactHoldTime = 0.f;
+
+        // Interaction state
+        AZ::EntityId m_activeCameraEntityId;
+        AZ::EntityId m_focusedEntityId;
+        AZ::u32 m_ticksSinceCast = 0;
+        AZ::Crc32 m_interactableTagCrc;
+        AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+        InteractHold m_interactHold;
+        // Progress last sent to the listeners
+        float m_interactProgress = 0.f;
+
+        // Events sent to interactables on state transitions versus the events a per-tick broadcast would have sent
+        AZ::u32 m_interactionEventsAccum = 0;
+        AZ::u32 m_perTickEventsAccum = 0;
+        AZ::u32 m_interactionEventsPerSecond = 0;
+        AZ::u32 m_perTickEventsPerSecond = 0;
+        float m_eventWindowTime = 0.f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,80 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/GamepadInput.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
+
+namespace FirstPersonController
+{
+    namespace
+    {
+        // Processed look magnitude at which the stick counts as fully deflected for the look acceleration
+        constexpr float LookAccelerationThreshold = 0.99f;
+    } // namespace
+
+    AZ::Vector2 GamepadInputProcessor::ApplyRadialDeadZone(const AZ::Vector2& stick, const float& innerDeadZone, const float& outerDeadZone)
+    {
+        const float magnitude = stick.GetLength();
+        if(magnitude <= innerDeadZone || magnitude == 0.f)
+            return AZ::Vector2::CreateZero();
+
+        const float range = AZ::GetMax(outerDeadZone - innerDeadZone, 0.001f);
+        const float scaledMagnitude = AZ::GetMin((magnitude - innerDeadZone) / range, 1.f);
+        return stick * (scaledMagnitude / magnitude);
+    }
+
+    AZ::Vector2 GamepadInputProcessor::ApplyResponseCurve(const AZ::Vector2& stick, const float& exponent)
+    {
+        const float magnitude = stick.GetLength();
+        if(magnitude == 0.f || exponent == 1.f)
+            return stick;
+
+        return stick * (AZStd::pow(AZ::GetMin(magnitude, 1.f), exponent) / magnitude);
+    }
+
+    AZ::Vector2 GamepadInputProcessor::GetMoveInput(const GamepadInputSettings& settings, const AZ::Vector2& leftStick) const
+    {
+        return ApplyResponseCurve(ApplyRadialDeadZone(leftStick, settings.m_innerDeadZone, settings.m_outerDeadZone),
+            settings.m_moveResponseExponent);
+    }
+
+    void GamepadInputProcessor::CombineMoveInput(const AZ::Vector2& move, float& forward, float& back, float& left, float& right)
+    {
+        forward = AZ::GetMax(forward, AZ::GetMax(move.GetY(), 0.f));
+        back = AZ::GetMax(back, AZ::GetMax(-move.GetY(), 0.f));
+        left = AZ::GetMax(left, AZ::GetMax(-move.GetX(), 0.f));
+        right = AZ::GetMax(right, AZ::GetMax(move.GetX(), 0.f));
+    }
+
+    AZ::Vector2 GamepadInputProcessor::UpdateLook(const GamepadInputSettings& settings, const AZ::Vector2& rightStick, const float& deltaTime)
+    {
+        const AZ::Vector2 look = ApplyResponseCurve(ApplyRadialDeadZone(rightStick, settings.m_innerDeadZone, settings.m_outerDeadZone),
+            settings.m_lookResponseExponent);
+
+        // The ramp is based on time held rather than ticks so that it is the same at any frame rate
+        if(look.GetLength() >= LookAccelerationThreshold)
+            m_lookAccelerationTime = AZ::GetMin(m_lookAccelerationTime + deltaTime, settings.m_lookAccelerationTime);
+        else
+            m_lookAccelerationTime = 0.f;
+
+        float accelerationScale = 1.f;
+        if(settings.m_lookAccelerationTime > 0.f)
+            accelerationScale += (settings.m_lookAccelerationScale - 1.f) * m_lookAccelerationTime / settings.m_lookAccelerationTime;
+
+        return AZ::Vector2(look.GetX() * AZ::DegToRad(settings.m_lookYawSpeed),
+            look.GetY() * AZ::DegToRad(settings.m_lookPitchSpeed)) * (accelerationScale * deltaTime);
+    }
+
+    void GamepadInputProcessor::Reset()
+    {
+        m_lookAccelerationTime = 0.f;
+    }
+
+    float GamepadInputProcessor::GetLookAccelerationTime() const
+    {
+        return m_lookAccelerationTime;
+    }
+} // namespace FirstPersonController
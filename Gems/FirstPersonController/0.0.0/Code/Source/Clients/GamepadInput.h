@@ -0,0 +1,64 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/RTTI/TypeInfo.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace FirstPersonController
+{
+    // Shaping of the gamepad thumbsticks, the dead zones and response curves apply to the stick's magnitude
+    // so that diagonals behave the same as the axes
+    struct GamepadInputSettings
+    {
+        AZ_TYPE_INFO(GamepadInputSettings, "{3b8e6f14-d27a-4c05-8e91-a4f0c7d2b6e3}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        bool m_enabled = true;
+        // Magnitudes below the inner dead zone read as zero and magnitudes above the outer dead zone read as one
+        float m_innerDeadZone = 0.15f;
+        float m_outerDeadZone = 0.95f;
+        // Exponents applied to the magnitude after the dead zones, above one gives finer control near the center
+        float m_moveResponseExponent = 1.f;
+        float m_lookResponseExponent = 2.f;
+        // Look rotation rates at full deflection, in degrees per second
+        float m_lookYawSpeed = 200.f;
+        float m_lookPitchSpeed = 140.f;
+        // While the look stick is held at full deflection the look rates ramp up to m_lookAccelerationScale
+        // times their value over m_lookAccelerationTime seconds
+        float m_lookAccelerationScale = 1.75f;
+        float m_lookAccelerationTime = 0.4f;
+    };
+
+    // Turns the cached thumbstick values into movement input values and look rotations once per tick
+    class GamepadInputProcessor
+    {
+    public:
+        // Maps the stick's magnitude from [innerDeadZone, outerDeadZone] to [0, 1] keeping its direction
+        static AZ::Vector2 ApplyRadialDeadZone(const AZ::Vector2& stick, const float& innerDeadZone, const float& outerDeadZone);
+        // Raises the magnitude of a stick within the unit circle to exponent keeping its direction
+        static AZ::Vector2 ApplyResponseCurve(const AZ::Vector2& stick, const float& exponent);
+
+        // Returns the movement input, X to the right and Y forward, each within [-1, 1]
+        AZ::Vector2 GetMoveInput(const GamepadInputSettings& settings, const AZ::Vector2& leftStick) const;
+        // Combines the movement input with the keyboard's input values, the greater of the two is kept in each direction
+        static void CombineMoveInput(const AZ::Vector2& move, float& forward, float& back, float& left, float& right);
+        // Returns the yaw (X, positive to the right) and pitch (Y, positive upward) to rotate by over deltaTime, in radians
+        AZ::Vector2 UpdateLook(const GamepadInputSettings& settings, const AZ::Vector2& rightStick, const float& deltaTime);
+        void Reset();
+
+        float GetLookAccelerationTime() const;
+
+    private:
+        // Time the look stick has been held at full deflection, limited to the settings' acceleration time
+        float m_lookAccelerationTime = 0.f;
+    };
+} // namespace FirstPersonController
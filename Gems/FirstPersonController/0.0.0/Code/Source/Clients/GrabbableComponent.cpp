@@ -0,0 +1,141 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/GrabbableComponent.h>
+
+#include <AzCore/Serialization/EditContext.h>
+
+namespace FirstPersonController
+{
+    void GrabbableComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<GrabbableComponent, AZ::Component>()
+              ->Field("Inspectable", &GrabbableComponent::m_inspectable)
+              ->Field("Follow Rate (1/s)", &GrabbableComponent::m_followRate)
+              ->Field("Max Follow Speed (m/s)", &GrabbableComponent::m_maxFollowSpeed)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Class<GrabbableComponent>("Grabbable",
+                    "Allows a dynamic rigid body to be grabbed, carried, inspected and thrown by the First Person Carry component")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller")
+                    ->DataElement(nullptr,
+                        &GrabbableComponent::m_inspectable,
+                        "Inspectable", "Determines whether the held entity can be rotated with the look input while inspecting.")
+                    ->DataElement(nullptr,
+                        &GrabbableComponent::m_followRate,
+                        "Follow Rate (1/s)", "Fraction of the distance and angle to the carry target that is closed per second while held. Higher values follow more tightly.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &GrabbableComponent::m_maxFollowSpeed,
+                        "Max Follow Speed (m/s)", "Upper limit on the velocity used to move the held entity towards the carry target.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f);
+            }
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->EBus<GrabbableNotificationBus>("GrabbableNotificationBus")
+                ->Handler<GrabbableNotificationHandler>();
+
+            bc->EBus<GrabbableComponentRequestBus>("GrabbableComponentRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Get Is Held", &GrabbableComponentRequests::GetIsHeld)
+                ->Event("Get Holder EntityId", &GrabbableComponentRequests::GetHolderEntityId)
+                ->Event("Get Inspectable", &GrabbableComponentRequests::GetInspectable)
+                ->Event("Set Inspectable", &GrabbableComponentRequests::SetInspectable)
+                ->Event("Get Follow Rate", &GrabbableComponentRequests::GetFollowRate)
+                ->Event("Set Follow Rate", &GrabbableComponentRequests::SetFollowRate)
+                ->Event("Get Max Follow Speed", &GrabbableComponentRequests::GetMaxFollowSpeed)
+                ->Event("Set Max Follow Speed", &GrabbableComponentRequests::SetMaxFollowSpeed);
+
+            bc->Class<GrabbableComponent>()->RequestBus("GrabbableComponentRequestBus");
+        }
+    }
+
+    void GrabbableComponent::Activate()
+    {
+        GrabbableComponentRequestBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void GrabbableComponent::Deactivate()
+    {
+        GrabbableComponentRequestBus::Handler::BusDisconnect();
+        m_holderEntityId = AZ::EntityId();
+    }
+
+    void GrabbableComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("PhysicsDynamicRigidBodyService"));
+    }
+
+    void GrabbableComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("GrabbableService"));
+    }
+
+    void GrabbableComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("GrabbableService"));
+    }
+
+    void GrabbableComponent::OnPickedUp(const AZ::EntityId& holderEntityId)
+    {
+        m_holderEntityId = holderEntityId;
+        GrabbableNotificationBus::Event(GetEntityId(), &GrabbableNotificationBus::Events::OnGrabbed, m_holderEntityId);
+    }
+
+    void GrabbableComponent::OnDropped(const bool& thrown)
+    {
+        const AZ::EntityId holderEntityId = m_holderEntityId;
+        m_holderEntityId = AZ::EntityId();
+
+        if(thrown)
+            GrabbableNotificationBus::Event(GetEntityId(), &GrabbableNotificationBus::Events::OnThrown, holderEntityId);
+        else
+            GrabbableNotificationBus::Event(GetEntityId(), &GrabbableNotificationBus::Events::OnReleased, holderEntityId);
+    }
+
+    // Request Bus getter and setter methods for use in scripts
+    bool GrabbableComponent::GetIsHeld() const
+    {
+        return m_holderEntityId.IsValid();
+    }
+    AZ::EntityId GrabbableComponent::GetHolderEntityId() const
+    {
+        return m_holderEntityId;
+    }
+    bool GrabbableComponent::GetInspectable() const
+    {
+        return m_inspectable;
+    }
+    void GrabbableComponent::SetInspectable(const bool& new_inspectable)
+    {
+        m_inspectable = new_inspectable;
+    }
+    float GrabbableComponent::GetFollowRate() const
+    {
+        return m_followRate;
+    }
+    void GrabbableComponent::SetFollowRate(const float& new_followRate)
+    {
+        m_followRate = AZ::GetMax(new_followRate, 0.f);
+    }
+    float GrabbableComponent::GetMaxFollowSpeed() const
+    {
+        return m_maxFollowSpeed;
+    }
+    void GrabbableComponent::SetMaxFollowSpeed(const float& new_maxFollowSpeed)
+    {
+        m_maxFollowSpeed = AZ::GetMax(new_maxFollowSpeed, 0.f);
+    }
+} // namespace FirstPersonController
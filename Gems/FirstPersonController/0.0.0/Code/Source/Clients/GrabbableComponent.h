@@ -0,0 +1,50 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+#include <FirstPersonController/GrabbableComponentBus.h>
+
+#include <AzCore/Component/Component.h>
+
+namespace FirstPersonController
+{
+    // Marks a dynamic rigid body as grabbable and holds how it follows the carry target
+    class GrabbableComponent
+        : public AZ::Component
+        , public GrabbableComponentRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(GrabbableComponent, "{e4a19c7b-5d30-4f62-9b8e-0c7f3a26d1e8}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // GrabbableComponentRequestBus
+        bool GetIsHeld() const override;
+        AZ::EntityId GetHolderEntityId() const override;
+        bool GetInspectable() const override;
+        void SetInspectable(const bool& new_inspectable) override;
+        float GetFollowRate() const override;
+        void SetFollowRate(const float& new_followRate) override;
+        float GetMaxFollowSpeed() const override;
+        void SetMaxFollowSpeed(const float& new_maxFollowSpeed) override;
+        void OnPickedUp(const AZ::EntityId& holderEntityId) override;
+        void OnDropped(const bool& thrown) override;
+
+    private:
+        // Grabbable settings
+        bool m_inspectable = true;
+        float m_followRate = 15.f;
+        float m_maxFollowSpeed = 20.f;
+
+        AZ::EntityId m_holderEntityId;
+    };
+} // namespace FirstPersonController
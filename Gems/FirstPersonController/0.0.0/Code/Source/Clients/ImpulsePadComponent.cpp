@@ -0,0 +1,213 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/ImpulsePadComponent.h>
+#include <Clients/ImpulsePadResponse.h>
+#include <Clients/PhysicsSceneLookup.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
+#include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/RigidBody.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
+
+namespace FirstPersonController
+{
+    void ImpulsePadComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<ImpulsePadComponent, AZ::Component>()
+              ->Field("Apex Height (m)", &ImpulsePadComponent::m_apexHeight)
+              ->Field("Restitution", &ImpulsePadComponent::m_restitution)
+              ->Field("Max Launch Speed (m/s)", &ImpulsePadComponent::m_maxLaunchSpeed)
+              ->Field("Affects Rigid Bodies", &ImpulsePadComponent::m_affectsRigidBodies)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Class<ImpulsePadComponent>("Impulse Pad",
+                    "Launches First Person Controllers and rigid bodies that enter this PhysX trigger collider along the entity's Z axis")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller")
+                    ->DataElement(nullptr,
+                        &ImpulsePadComponent::m_apexHeight,
+                        "Apex Height (m)", "Minimum height reached above the point of entry, along the entity's Z axis. The launch speed is computed from the character's gravity, or the scene's gravity for rigid bodies.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &ImpulsePadComponent::m_restitution,
+                        "Restitution", "Fraction of the incoming speed into the pad that is reflected back. With 0, every bounce reaches the Apex Height. With 1, a higher fall bounces higher.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &ImpulsePadComponent::m_maxLaunchSpeed,
+                        "Max Launch Speed (m/s)", "Limit on the speed of the bounce, 0 for no limit.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &ImpulsePadComponent::m_affectsRigidBodies,
+                        "Affects Rigid Bodies", "Determines whether dynamic rigid bodies are launched as well as characters.");
+            }
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->EBus<ImpulsePadComponentRequestBus>("ImpulsePadComponentRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Get Apex Height", &ImpulsePadComponentRequests::GetApexHeight)
+                ->Event("Set Apex Height", &ImpulsePadComponentRequests::SetApexHeight)
+                ->Event("Get Restitution", &ImpulsePadComponentRequests::GetRestitution)
+                ->Event("Set Restitution", &ImpulsePadComponentRequests::SetRestitution)
+                ->Event("Get Max Launch Speed", &ImpulsePadComponentRequests::GetMaxLaunchSpeed)
+                ->Event("Set Max Launch Speed", &ImpulsePadComponentRequests::SetMaxLaunchSpeed)
+                ->Event("Get Affects Rigid Bodies", &ImpulsePadComponentRequests::GetAffectsRigidBodies)
+                ->Event("Set Affects Rigid Bodies", &ImpulsePadComponentRequests::SetAffectsRigidBodies);
+
+            bc->Class<ImpulsePadComponent>()->RequestBus("ImpulsePadComponentRequestBus");
+        }
+    }
+
+    void ImpulsePadComponent::Activate()
+    {
+        m_onTriggerEnterHandler = AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler(
+            [this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle, const AzPhysics::TriggerEvent& triggerEvent)
+            {
+                OnTriggerEnter(triggerEvent);
+            });
+
+        AzPhysics::SimulatedBodyHandle bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(bodyHandle, GetEntityId(),
+            &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBodyHandle);
+        m_sceneHandle = GetEntityPhysicsScene(GetEntityId());
+
+        if(bodyHandle == AzPhysics::InvalidSimulatedBodyHandle || m_sceneHandle == AzPhysics::InvalidSceneHandle)
+            AZ_Warning("Impulse Pad Component", false, "No simulated body was found on the impulse pad entity, the impulse pad requires a PhysX trigger collider.");
+        else
+            AzPhysics::SimulatedBodyEvents::RegisterOnTriggerEnterHandler(m_sceneHandle, bodyHandle, m_onTriggerEnterHandler);
+
+        ImpulsePadComponentRequestBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void ImpulsePadComponent::Deactivate()
+    {
+        ImpulsePadComponentRequestBus::Handler::BusDisconnect();
+        m_onTriggerEnterHandler.Disconnect();
+        m_sceneHandle = AzPhysics::InvalidSceneHandle;
+    }
+
+    void ImpulsePadComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("TransformService"));
+        required.push_back(AZ_CRC_CE("PhysicsTriggerService"));
+    }
+
+    void ImpulsePadComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        // The simulated body needs to exist before the trigger handler is registered
+        dependent.push_back(AZ_CRC_CE("PhysicsWorldBodyService"));
+    }
+
+    void ImpulsePadComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("ImpulsePadService"));
+    }
+
+    void ImpulsePadComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("ImpulsePadService"));
+        incompatible.push_back(AZ_CRC_CE("TeleporterService"));
+        incompatible.push_back(AZ_CRC_CE("LadderService"));
+    }
+
+    AZ::Vector3 ImpulsePadComponent::GetPadNormal() const
+    {
+        AZ::Transform padTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(padTM, GetEntityId(), &AZ::TransformBus::Events::GetWorldTM);
+        return padTM.GetBasisZ().GetNormalizedSafe();
+    }
+
+    void ImpulsePadComponent::OnTriggerEnter(const AzPhysics::TriggerEvent& triggerEvent)
+    {
+        if(triggerEvent.m_otherBody == nullptr)
+            return;
+
+        const AZ::EntityId otherEntityId = triggerEvent.m_otherBody->GetEntityId();
+
+        // Characters have no rigid body velocity to act on, so the bounce is handed to the controller as a launch velocity
+        if(FirstPersonControllerComponentRequestBus::HasHandlers(otherEntityId))
+        {
+            AZ::Vector3 incomingVelocity = AZ::Vector3::CreateZero();
+            FirstPersonControllerComponentRequestBus::EventResult(incomingVelocity, otherEntityId,
+                &FirstPersonControllerComponentRequestBus::Events::GetPrevTargetVelocityWorld);
+            float gravity = 0.f;
+            FirstPersonControllerComponentRequestBus::EventResult(gravity, otherEntityId,
+                &FirstPersonControllerComponentRequestBus::Events::GetGravity);
+
+            const AZ::Vector3 bounceVelocity = ImpulsePadResponse::GetBounceVelocity(incomingVelocity, GetPadNormal(),
+                m_restitution, m_apexHeight, gravity, m_maxLaunchSpeed);
+            FirstPersonControllerComponentRequestBus::Event(otherEntityId,
+                &FirstPersonControllerComponentRequestBus::Events::Launch, bounceVelocity);
+            return;
+        }
+
+        if(!m_affectsRigidBodies)
+            return;
+
+        AzPhysics::RigidBody* body = nullptr;
+        Physics::RigidBodyRequestBus::EventResult(body, otherEntityId, &Physics::RigidBodyRequests::GetRigidBody);
+        if(body == nullptr || body->IsKinematic())
+            return;
+
+        float gravity = 0.f;
+        if(auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            gravity = sceneInterface->GetGravity(m_sceneHandle).GetLength();
+
+        const AZ::Vector3 incomingVelocity = body->GetLinearVelocity();
+        const AZ::Vector3 bounceVelocity = ImpulsePadResponse::GetBounceVelocity(incomingVelocity, GetPadNormal(),
+            m_restitution, m_apexHeight, gravity, m_maxLaunchSpeed);
+        body->ApplyLinearImpulse((bounceVelocity - incomingVelocity) * body->GetMass());
+    }
+
+    // Request Bus getter and setter methods for use in scripts
+    float ImpulsePadComponent::GetApexHeight() const
+    {
+        return m_apexHeight;
+    }
+    void ImpulsePadComponent::SetApexHeight(const float& new_apexHeight)
+    {
+        m_apexHeight = AZ::GetMax(new_apexHeight, 0.f);
+    }
+    float ImpulsePadComponent::GetRestitution() const
+    {
+        return m_restitution;
+    }
+    void ImpulsePadComponent::SetRestitution(const float& new_restitution)
+    {
+        m_restitution = AZ::GetMax(new_restitution, 0.f);
+    }
+    float ImpulsePadComponent::GetMaxLaunchSpeed() const
+    {
+        return m_maxLaunchSpeed;
+    }
+    void ImpulsePadComponent::SetMaxLaunchSpeed(const float& new_maxLaunchSpeed)
+    {
+        m_maxLaunchSpeed = AZ::GetMax(new_maxLaunchSpeed, 0.f);
+    }
+    bool ImpulsePadComponent::GetAffectsRigidBodies() const
+    {
+        return m_affectsRigidBodies;
+    }
+    void ImpulsePadComponent::SetAffectsRigidBodies(const bool& new_affectsRigidBodies)
+    {
+        m_affectsRigidBodies = new_affectsRigidBodies;
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,59 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+#include <FirstPersonController/ImpulsePadComponentBus.h>
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Math/Vector3.h>
+
+#include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
+
+namespace FirstPersonController
+{
+    // Launches First Person Controllers and dynamic rigid bodies that enter the trigger volume along the entity's Z axis.
+    // The bounce velocity is computed once on entry, characters are launched through the controller's vertical velocity
+    // and rigid bodies receive the equivalent linear impulse.
+    class ImpulsePadComponent
+        : public AZ::Component
+        , public ImpulsePadComponentRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(ImpulsePadComponent, "{2b7f9e14-6a3d-4c58-8f01-d5e92a7c3b60}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // ImpulsePadComponentRequestBus
+        float GetApexHeight() const override;
+        void SetApexHeight(const float& new_apexHeight) override;
+        float GetRestitution() const override;
+        void SetRestitution(const float& new_restitution) override;
+        float GetMaxLaunchSpeed() const override;
+        void SetMaxLaunchSpeed(const float& new_maxLaunchSpeed) override;
+        bool GetAffectsRigidBodies() const override;
+        void SetAffectsRigidBodies(const bool& new_affectsRigidBodies) override;
+
+    private:
+        void OnTriggerEnter(const AzPhysics::TriggerEvent& triggerEvent);
+        AZ::Vector3 GetPadNormal() const;
+
+        // Impulse pad settings
+        float m_apexHeight = 4.f;
+        float m_restitution = 0.f;
+        float m_maxLaunchSpeed = 30.f;
+        bool m_affectsRigidBodies = true;
+
+        AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+        AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler m_onTriggerEnterHandler;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,44 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/ImpulsePadResponse.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
+
+namespace FirstPersonController
+{
+    float ImpulsePadResponse::GetLaunchSpeed(const float& apexHeight, const float& gravity)
+    {
+        // From v^2 = 2gh at the apex
+        return AZStd::sqrt(2.f * AZ::GetAbs(gravity) * AZ::GetMax(apexHeight, 0.f));
+    }
+
+    AZ::Vector3 ImpulsePadResponse::Reflect(const AZ::Vector3& velocity, const AZ::Vector3& normal, const float& restitution)
+    {
+        const float normalSpeed = velocity.Dot(normal);
+        // Only velocity heading into the pad is reflected
+        if(normalSpeed >= 0.f)
+            return velocity;
+
+        return velocity - normal * ((1.f + AZ::GetMax(restitution, 0.f)) * normalSpeed);
+    }
+
+    AZ::Vector3 ImpulsePadResponse::GetBounceVelocity(const AZ::Vector3& incomingVelocity, const AZ::Vector3& normal, const float& restitution,
+        const float& apexHeight, const float& gravity, const float& maxSpeed)
+    {
+        AZ::Vector3 bounceVelocity = Reflect(incomingVelocity, normal, restitution);
+
+        const float launchSpeed = GetLaunchSpeed(apexHeight, gravity);
+        const float normalSpeed = bounceVelocity.Dot(normal);
+        if(normalSpeed < launchSpeed)
+            bounceVelocity += normal * (launchSpeed - normalSpeed);
+
+        const float speedSq = bounceVelocity.GetLengthSq();
+        if(maxSpeed > 0.f && speedSq > maxSpeed * maxSpeed)
+            bounceVelocity = bounceVelocity * (maxSpeed / AZStd::sqrt(speedSq));
+
+        return bounceVelocity;
+    }
+} // namespace FirstPersonController
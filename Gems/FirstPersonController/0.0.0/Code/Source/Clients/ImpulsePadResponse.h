@@ -0,0 +1,26 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+
+namespace FirstPersonController
+{
+    // Analytic bounce response of an impulse pad, shared by characters and rigid bodies
+    class ImpulsePadResponse
+    {
+    public:
+        // Speed along the pad's normal needed to rise apexHeight against a gravity of the given magnitude
+        static float GetLaunchSpeed(const float& apexHeight, const float& gravity);
+
+        // Reflects velocity about the plane with the given unit normal, scaling the normal component by restitution
+        static AZ::Vector3 Reflect(const AZ::Vector3& velocity, const AZ::Vector3& normal, const float& restitution);
+
+        // The reflected incoming velocity, with its normal component raised to at least the launch speed for apexHeight
+        // and limited to maxSpeed. A restitution of zero always launches to exactly apexHeight.
+        static AZ::Vector3 GetBounceVelocity(const AZ::Vector3& incomingVelocity, const AZ::Vector3& normal, const float& restitution,
+            const float& apexHeight, const float& gravity, const float& maxSpeed);
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,91 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/InputOverrideStack.h>
+
+namespace FirstPersonController
+{
+    AZ::u32 InputOverrideStack::Push(const InputOverride& inputOverride)
+    {
+        Entry entry;
+        entry.m_handle = m_nextHandle++;
+        if(m_nextHandle == 0)
+            m_nextHandle = 1;
+        entry.m_override = inputOverride;
+        entry.m_ticksLeft = inputOverride.m_ticks;
+
+        // Insert after every entry of the same or a lower priority
+        size_t index = m_entries.size();
+        while(index > 0 && m_entries[index - 1].m_override.m_priority > inputOverride.m_priority)
+            --index;
+        m_entries.insert(m_entries.begin() + index, entry);
+
+        return entry.m_handle;
+    }
+
+    bool InputOverrideStack::Pop(const AZ::u32& handle)
+    {
+        for(size_t i = 0; i < m_entries.size(); ++i)
+            if(m_entries[i].m_handle == handle)
+            {
+                m_entries.erase(m_entries.begin() + i);
+                return true;
+            }
+        return false;
+    }
+
+    void InputOverrideStack::Clear()
+    {
+        m_entries.clear();
+    }
+
+    AZ::u32 InputOverrideStack::Apply(InputChannelValues& values) const
+    {
+        AZ::u32 appliedMask = 0;
+        for(const Entry& entry : m_entries)
+        {
+            const InputOverride& inputOverride = entry.m_override;
+            const InputChannelValues overrideValues = { inputOverride.m_forwardValue, inputOverride.m_backValue,
+                inputOverride.m_leftValue, inputOverride.m_rightValue, inputOverride.m_yawValue, inputOverride.m_pitchValue,
+                inputOverride.m_sprintValue, inputOverride.m_crouchValue, inputOverride.m_jumpValue };
+
+            for(AZ::u32 channel = 0; channel < InputOverrideChannelCount; ++channel)
+                if(inputOverride.m_mask & (1u << channel))
+                    values[channel] = overrideValues[channel];
+
+            appliedMask |= inputOverride.m_mask & InputOverrideAllChannels;
+        }
+        return appliedMask;
+    }
+
+    void InputOverrideStack::Restore(InputChannelValues& values, const InputChannelValues& rawValues,
+        const InputChannelValues& appliedValues, const AZ::u32& mask)
+    {
+        for(AZ::u32 channel = 0; channel < InputOverrideChannelCount; ++channel)
+            if((mask & (1u << channel)) && values[channel] == appliedValues[channel])
+                values[channel] = rawValues[channel];
+    }
+
+    void InputOverrideStack::Tick()
+    {
+        for(size_t i = 0; i < m_entries.size();)
+        {
+            Entry& entry = m_entries[i];
+            if(entry.m_override.m_ticks != 0 && --entry.m_ticksLeft == 0)
+                m_entries.erase(m_entries.begin() + i);
+            else
+                ++i;
+        }
+    }
+
+    AZ::u32 InputOverrideStack::GetCount() const
+    {
+        return static_cast<AZ::u32>(m_entries.size());
+    }
+
+    bool InputOverrideStack::IsEmpty() const
+    {
+        return m_entries.empty();
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,51 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <FirstPersonController/InputOverride.h>
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace FirstPersonController
+{
+    // Input values in the order of the InputOverrideChannel bits
+    using InputChannelValues = AZStd::array<float, InputOverrideChannelCount>;
+
+    // Layered input overrides of a controller, consulted once per step instead of scripts writing the input values every frame
+    class InputOverrideStack
+    {
+    public:
+        // Returns the handle used to pop the override, never 0
+        AZ::u32 Push(const InputOverride& inputOverride);
+        // Returns false if the override was already popped or has expired
+        bool Pop(const AZ::u32& handle);
+        void Clear();
+
+        // Replaces the masked values with those of the overrides, returns the mask of the replaced channels
+        AZ::u32 Apply(InputChannelValues& values) const;
+        // Puts the raw values back in the masked channels that still hold the applied values,
+        // a channel written since the overrides were applied keeps the newer value
+        static void Restore(InputChannelValues& values, const InputChannelValues& rawValues, const InputChannelValues& appliedValues,
+            const AZ::u32& mask);
+        // Counts down the overrides that last a number of ticks and removes the expired ones
+        void Tick();
+
+        AZ::u32 GetCount() const;
+        bool IsEmpty() const;
+
+    private:
+        struct Entry
+        {
+            AZ::u32 m_handle = 0;
+            InputOverride m_override;
+            AZ::u32 m_ticksLeft = 0;
+        };
+
+        // Sorted by priority then by push order, so that later entries win when applied
+        AZStd::vector<Entry> m_entries;
+        AZ::u32 m_nextHandle = 1;
+    };
+} // namespace FirstPersonController
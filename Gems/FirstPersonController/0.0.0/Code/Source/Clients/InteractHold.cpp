@@ -0,0 +1,46 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/InteractHold.h>
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace FirstPersonController
+{
+    bool InteractHold::Press(const float& holdTime)
+    {
+        m_progress = 0.f;
+        m_held = holdTime > 0.f;
+        return !m_held;
+    }
+
+    void InteractHold::Release()
+    {
+        m_held = false;
+        m_progress = 0.f;
+    }
+
+    bool InteractHold::Update(const float& deltaTime, const float& holdTime)
+    {
+        if(!m_held || holdTime <= 0.f)
+            return false;
+
+        m_progress = AZ::GetMin(m_progress + deltaTime / holdTime, 1.f);
+        if(m_progress < 1.f)
+            return false;
+
+        m_held = false;
+        return true;
+    }
+
+    bool InteractHold::IsHeld() const
+    {
+        return m_held;
+    }
+
+    float InteractHold::GetProgress() const
+    {
+        return m_progress;
+    }
+} // namespace FirstPersonController
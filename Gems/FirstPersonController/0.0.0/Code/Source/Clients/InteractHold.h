@@ -0,0 +1,28 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+namespace FirstPersonController
+{
+    // Progress of an interact key that has to be held for a hold time before the interaction happens
+    class InteractHold
+    {
+    public:
+        // Starts holding from zero progress, returns true when the press interacts right away since there is no hold time
+        bool Press(const float& holdTime);
+        // Stops holding and resets the progress, as when the key is released, the hold completes or the focus changes
+        void Release();
+        // Advances the progress of a held key by deltaTime. Returns true when the progress reaches one, the hold then
+        // ends so that another interaction needs a new press.
+        bool Update(const float& deltaTime, const float& holdTime);
+
+        bool IsHeld() const;
+        float GetProgress() const;
+
+    private:
+        bool m_held = false;
+        float m_progress = 0.f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,71 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/InteractableComponent.h>
+
+#include <AzCore/Serialization/EditContext.h>
+
+#include <FirstPersonController/InteractableRegistryBus.h>
+
+namespace FirstPersonController
+{
+    void InteractableComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<InteractableComponent, AZ::Component>()
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Class<InteractableComponent>("Interactable",
+                    "Registers the entity as an interactable so it can be found by radius and view cone queries without physics casts")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller");
+            }
+        }
+    }
+
+    void InteractableComponent::Activate()
+    {
+        AZ::Transform worldTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(worldTM, GetEntityId(), &AZ::TransformBus::Events::GetWorldTM);
+
+        if(auto* registry = InteractableRegistryInterface::Get())
+            registry->RegisterInteractable(GetEntityId(), worldTM.GetTranslation());
+
+        AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void InteractableComponent::Deactivate()
+    {
+        AZ::TransformNotificationBus::Handler::BusDisconnect();
+
+        if(auto* registry = InteractableRegistryInterface::Get())
+            registry->UnregisterInteractable(GetEntityId());
+    }
+
+    void InteractableComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("TransformService"));
+    }
+
+    void InteractableComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("InteractableService"));
+    }
+
+    void InteractableComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("InteractableService"));
+    }
+
+    void InteractableComponent::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
+    {
+        if(auto* registry = InteractableRegistryInterface::Get())
+            registry->RegisterInteractable(GetEntityId(), world.GetTranslation());
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,33 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TransformBus.h>
+
+namespace FirstPersonController
+{
+    // Registers its entity with the interactable registry and keeps the registered position up to date
+    class InteractableComponent
+        : public AZ::Component
+        , public AZ::TransformNotificationBus::Handler
+    {
+    public:
+        AZ_COMPONENT(InteractableComponent, "{c0f47d26-93a8-4e1b-8d5f-6a2e17b94c30}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // AZ::TransformNotificationBus interface
+        void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,193 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/InteractableSpatialGrid.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/math.h>
+
+namespace FirstPersonController
+{
+    namespace
+    {
+        // Each cell coordinate is stored in 21 bits of the cell key
+        constexpr AZ::s32 CellCoordinateBias = 1 << 20;
+        constexpr AZ::u64 CellCoordinateMask = (1ull << 21) - 1;
+    } // namespace
+
+    InteractableSpatialGrid::InteractableSpatialGrid(const float& cellSize)
+        : m_cellSize(AZ::GetMax(cellSize, 0.01f))
+        , m_inverseCellSize(1.f / m_cellSize)
+    {
+    }
+
+    void InteractableSpatialGrid::Insert(const AZ::EntityId& entityId, const AZ::Vector3& position)
+    {
+        const CellKey key = GetCellKey(position);
+
+        auto entityCell = m_entityCells.find(entityId);
+        if(entityCell != m_entityCells.end())
+        {
+            // Moving within the same cell only updates the stored position
+            if(entityCell->second == key)
+            {
+                for(Entry& entry : m_cells[key])
+                    if(entry.m_entityId == entityId)
+                    {
+                        entry.m_position = position;
+                        return;
+                    }
+            }
+            RemoveFromCell(entityCell->second, entityId);
+            entityCell->second = key;
+        }
+        else
+            m_entityCells.emplace(entityId, key);
+
+        m_cells[key].push_back({ entityId, position });
+    }
+
+    void InteractableSpatialGrid::Remove(const AZ::EntityId& entityId)
+    {
+        auto entityCell = m_entityCells.find(entityId);
+        if(entityCell == m_entityCells.end())
+            return;
+
+        RemoveFromCell(entityCell->second, entityId);
+        m_entityCells.erase(entityCell);
+    }
+
+    void InteractableSpatialGrid::Clear()
+    {
+        m_cells.clear();
+        m_entityCells.clear();
+    }
+
+    void InteractableSpatialGrid::QueryRadius(const AZ::Vector3& center, const float& radius, AZStd::vector<AZ::EntityId>& results) const
+    {
+        const float radiusSq = radius * radius;
+        QueryBounds(center, radius, results,
+            [&center, &radiusSq](const AZ::Vector3& position)
+            {
+                return position.GetDistanceSq(center) <= radiusSq;
+            });
+    }
+
+    void InteractableSpatialGrid::QueryCone(const AZ::Vector3& origin, const AZ::Vector3& direction, const float& maxDistance,
+        const float& halfAngle, AZStd::vector<AZ::EntityId>& results) const
+    {
+        const float maxDistanceSq = maxDistance * maxDistance;
+        const float cosHalfAngle = AZStd::cos(AZ::GetClamp(halfAngle, 0.f, AZ::Constants::Pi));
+        const float cosHalfAngleSq = cosHalfAngle * cosHalfAngle;
+        QueryBounds(origin, maxDistance, results,
+            [&origin, &direction, &maxDistanceSq, &cosHalfAngle, &cosHalfAngleSq](const AZ::Vector3& position)
+            {
+                const AZ::Vector3 offset = position - origin;
+                const float distanceSq = offset.GetLengthSq();
+                if(distanceSq > maxDistanceSq)
+                    return false;
+                if(distanceSq == 0.f)
+                    return true;
+
+                // Compares dot / length against cos(halfAngle) without a square root
+                const float dot = offset.Dot(direction);
+                if(cosHalfAngle >= 0.f)
+                    return dot >= 0.f && dot * dot >= cosHalfAngleSq * distanceSq;
+                return dot >= 0.f || dot * dot <= cosHalfAngleSq * distanceSq;
+            });
+    }
+
+    bool InteractableSpatialGrid::Contains(const AZ::EntityId& entityId) const
+    {
+        return m_entityCells.find(entityId) != m_entityCells.end();
+    }
+
+    AZ::u32 InteractableSpatialGrid::GetCount() const
+    {
+        return static_cast<AZ::u32>(m_entityCells.size());
+    }
+
+    float InteractableSpatialGrid::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    InteractableSpatialGrid::CellKey InteractableSpatialGrid::GetCellKey(const AZ::Vector3& position) const
+    {
+        return GetCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()), GetCellCoordinate(position.GetZ()));
+    }
+
+    InteractableSpatialGrid::CellKey InteractableSpatialGrid::GetCellKey(const AZ::s32& x, const AZ::s32& y, const AZ::s32& z) const
+    {
+        return (static_cast<AZ::u64>(x + CellCoordinateBias) & CellCoordinateMask)
+            | ((static_cast<AZ::u64>(y + CellCoordinateBias) & CellCoordinateMask) << 21)
+            | ((static_cast<AZ::u64>(z + CellCoordinateBias) & CellCoordinateMask) << 42);
+    }
+
+    AZ::s32 InteractableSpatialGrid::GetCellCoordinate(const float& value) const
+    {
+        const float cell = AZStd::floor(value * m_inverseCellSize);
+        return static_cast<AZ::s32>(AZ::GetClamp(cell, static_cast<float>(1 - CellCoordinateBias), static_cast<float>(CellCoordinateBias - 1)));
+    }
+
+    void InteractableSpatialGrid::RemoveFromCell(const CellKey& key, const AZ::EntityId& entityId)
+    {
+        auto cell = m_cells.find(key);
+        if(cell == m_cells.end())
+            return;
+
+        AZStd::vector<Entry>& entries = cell->second;
+        for(size_t i = 0; i < entries.size(); ++i)
+            if(entries[i].m_entityId == entityId)
+            {
+                entries[i] = entries.back();
+                entries.pop_back();
+                break;
+            }
+
+        if(entries.empty())
+            m_cells.erase(cell);
+    }
+
+    template<typename Predicate>
+    void InteractableSpatialGrid::QueryBounds(const AZ::Vector3& center, const float& radius, AZStd::vector<AZ::EntityId>& results,
+        const Predicate& predicate) const
+    {
+        if(radius < 0.f || m_cells.empty())
+            return;
+
+        const AZ::Vector3 extents = AZ::Vector3(radius);
+        const AZ::Vector3 min = center - extents;
+        const AZ::Vector3 max = center + extents;
+        const AZ::s32 minX = GetCellCoordinate(min.GetX()), maxX = GetCellCoordinate(max.GetX());
+        const AZ::s32 minY = GetCellCoordinate(min.GetY()), maxY = GetCellCoordinate(max.GetY());
+        const AZ::s32 minZ = GetCellCoordinate(min.GetZ()), maxZ = GetCellCoordinate(max.GetZ());
+
+        const AZ::u64 boundsCellCount = static_cast<AZ::u64>(maxX - minX + 1) * static_cast<AZ::u64>(maxY - minY + 1)
+            * static_cast<AZ::u64>(maxZ - minZ + 1);
+
+        // Large queries over a sparse grid visit the occupied cells rather than every cell in the bounds
+        if(boundsCellCount > m_cells.size())
+        {
+            for(const auto& cell : m_cells)
+                for(const Entry& entry : cell.second)
+                    if(predicate(entry.m_position))
+                        results.push_back(entry.m_entityId);
+            return;
+        }
+
+        for(AZ::s32 z = minZ; z <= maxZ; ++z)
+            for(AZ::s32 y = minY; y <= maxY; ++y)
+                for(AZ::s32 x = minX; x <= maxX; ++x)
+                {
+                    auto cell = m_cells.find(GetCellKey(x, y, z));
+                    if(cell == m_cells.end())
+                        continue;
+
+                    for(const Entry& entry : cell->second)
+                        if(predicate(entry.m_position))
+                            results.push_back(entry.m_entityId);
+                }
+    }
+} // namespace FirstPersonController
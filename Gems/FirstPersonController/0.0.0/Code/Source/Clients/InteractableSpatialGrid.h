@@ -0,0 +1,57 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace FirstPersonController
+{
+    // Uniform hash grid of interactable entity positions, answering radius and view-cone queries without physics
+    class InteractableSpatialGrid
+    {
+    public:
+        explicit InteractableSpatialGrid(const float& cellSize = 4.f);
+
+        // Inserts the entity or moves it if it is already in the grid
+        void Insert(const AZ::EntityId& entityId, const AZ::Vector3& position);
+        void Remove(const AZ::EntityId& entityId);
+        void Clear();
+
+        // Appends the entities within radius of center to results
+        void QueryRadius(const AZ::Vector3& center, const float& radius, AZStd::vector<AZ::EntityId>& results) const;
+        // Appends the entities within maxDistance of origin and within halfAngle (radians) of the normalized direction to results
+        void QueryCone(const AZ::Vector3& origin, const AZ::Vector3& direction, const float& maxDistance, const float& halfAngle,
+            AZStd::vector<AZ::EntityId>& results) const;
+
+        bool Contains(const AZ::EntityId& entityId) const;
+        AZ::u32 GetCount() const;
+        float GetCellSize() const;
+
+    private:
+        using CellKey = AZ::u64;
+
+        struct Entry
+        {
+            AZ::EntityId m_entityId;
+            AZ::Vector3 m_position;
+        };
+
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+        CellKey GetCellKey(const AZ::s32& x, const AZ::s32& y, const AZ::s32& z) const;
+        AZ::s32 GetCellCoordinate(const float& value) const;
+        void RemoveFromCell(const CellKey& key, const AZ::EntityId& entityId);
+
+        template<typename Predicate>
+        void QueryBounds(const AZ::Vector3& center, const float& radius, AZStd::vector<AZ::EntityId>& results, const Predicate& predicate) const;
+
+        float m_cellSize = 4.f;
+        float m_inverseCellSize = 0.25f;
+        AZStd::unordered_map<CellKey, AZStd::vector<Entry>> m_cells;
+        AZStd::unordered_map<AZ::EntityId, CellKey> m_entityCells;
+    };
+} // namespace FirstPersonController
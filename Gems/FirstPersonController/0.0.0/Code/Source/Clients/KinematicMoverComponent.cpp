@@ -0,0 +1,168 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/KinematicMoverComponent.h>
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Serialization/EditContext.h>
+
+namespace FirstPersonController
+{
+    void KinematicMoverComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Enum<KinematicMoverEasing>()
+                ->Value("Linear", KinematicMoverEasing::Linear)
+                ->Value("Smooth Step", KinematicMoverEasing::SmoothStep);
+
+            sc->Class<KinematicMoverComponent, AZ::Component>()
+              ->Field("End Translation Offset", &KinematicMoverComponent::m_endTranslationOffset)
+              ->Field("End Rotation (degrees)", &KinematicMoverComponent::m_endRotationDegrees)
+              ->Field("Travel Time (s)", &KinematicMoverComponent::m_travelTime)
+              ->Field("Easing", &KinematicMoverComponent::m_easing)
+              ->Field("Initial Position", &KinematicMoverComponent::m_initialPosition)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Enum<KinematicMoverEasing>("Kinematic Mover Easing", "How the position is eased between the start and end poses")
+                    ->Value("Linear", KinematicMoverEasing::Linear)
+                    ->Value("Smooth Step", KinematicMoverEasing::SmoothStep);
+
+                ec->Class<KinematicMoverComponent>("Kinematic Mover",
+                    "Moves a kinematic rigid body between its start pose and an end pose when told to go to a position between 0 and 1")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller")
+                    ->DataElement(nullptr,
+                        &KinematicMoverComponent::m_endTranslationOffset,
+                        "End Translation Offset", "Offset of the end pose from the start pose, in the entity's local frame.")
+                    ->DataElement(nullptr,
+                        &KinematicMoverComponent::m_endRotationDegrees,
+                        "End Rotation (degrees)", "Rotation of the end pose relative to the start pose, as local Euler angles.")
+                    ->DataElement(nullptr,
+                        &KinematicMoverComponent::m_travelTime,
+                        "Travel Time (s)", "Time taken to move from the start pose to the end pose.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(AZ::Edit::UIHandlers::ComboBox,
+                        &KinematicMoverComponent::m_easing,
+                        "Easing", "How the position is eased between the start and end poses.")
+                        ->EnumAttribute(KinematicMoverEasing::Linear, "Linear")
+                        ->EnumAttribute(KinematicMoverEasing::SmoothStep, "Smooth Step")
+                    ->DataElement(nullptr,
+                        &KinematicMoverComponent::m_initialPosition,
+                        "Initial Position", "Position at which the entity's placed pose lies, 0 for the start pose and 1 for the end pose.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                        ->Attribute(AZ::Edit::Attributes::Max, 1.f);
+            }
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->EBus<KinematicMoverNotificationBus>("KinematicMoverNotificationBus")
+                ->Handler<KinematicMoverNotificationHandler>();
+
+            bc->EBus<KinematicMoverComponentRequestBus>("KinematicMoverComponentRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Go To", &KinematicMoverComponentRequests::GoTo)
+                ->Event("Stop", &KinematicMoverComponentRequests::Stop)
+                ->Event("Get Position", &KinematicMoverComponentRequests::GetPosition)
+                ->Event("Get Target Position", &KinematicMoverComponentRequests::GetTargetPosition)
+                ->Event("Get Is Moving", &KinematicMoverComponentRequests::GetIsMoving)
+                ->Event("Get Travel Time", &KinematicMoverComponentRequests::GetTravelTime)
+                ->Event("Set Travel Time", &KinematicMoverComponentRequests::SetTravelTime);
+
+            bc->Class<KinematicMoverComponent>()->RequestBus("KinematicMoverComponentRequestBus");
+        }
+    }
+
+    void KinematicMoverComponent::Activate()
+    {
+        AZ::Transform placedTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(placedTM, GetEntityId(), &AZ::TransformBus::Events::GetWorldTM);
+
+        // The entity is placed at its initial position, so the start pose is worked back from there
+        const AZ::Transform offsetTM(m_endTranslationOffset,
+            AZ::Quaternion::CreateFromEulerAnglesDegrees(m_endRotationDegrees), 1.f);
+        const float initialPosition = AZ::GetClamp(m_initialPosition, 0.f, 1.f);
+        AZ::Transform startTM = placedTM;
+        if(initialPosition > 0.f)
+        {
+            AZ::Transform partialOffsetTM(m_endTranslationOffset * initialPosition,
+                AZ::Quaternion::CreateIdentity().Slerp(offsetTM.GetRotation(), initialPosition), 1.f);
+            startTM = placedTM * partialOffsetTM.GetInverse();
+        }
+        const AZ::Transform endTM = startTM * offsetTM;
+
+        if(auto* moverSystem = KinematicMoverSystemInterface::Get())
+            moverSystem->AddMover(GetEntityId(), startTM, endTM, m_travelTime, m_easing, initialPosition);
+
+        KinematicMoverComponentRequestBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void KinematicMoverComponent::Deactivate()
+    {
+        KinematicMoverComponentRequestBus::Handler::BusDisconnect();
+
+        if(auto* moverSystem = KinematicMoverSystemInterface::Get())
+            moverSystem->RemoveMover(GetEntityId());
+    }
+
+    void KinematicMoverComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("TransformService"));
+        required.push_back(AZ_CRC_CE("PhysicsRigidBodyService"));
+    }
+
+    void KinematicMoverComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("KinematicMoverService"));
+    }
+
+    void KinematicMoverComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("KinematicMoverService"));
+    }
+
+    // Request Bus getter and setter methods for use in scripts
+    void KinematicMoverComponent::GoTo(const float& new_targetPosition)
+    {
+        if(auto* moverSystem = KinematicMoverSystemInterface::Get())
+            moverSystem->GoTo(GetEntityId(), new_targetPosition);
+    }
+    void KinematicMoverComponent::Stop()
+    {
+        if(auto* moverSystem = KinematicMoverSystemInterface::Get())
+            moverSystem->Stop(GetEntityId());
+    }
+    float KinematicMoverComponent::GetPosition() const
+    {
+        const auto* moverSystem = KinematicMoverSystemInterface::Get();
+        return moverSystem != nullptr ? moverSystem->GetPosition(GetEntityId()) : 0.f;
+    }
+    float KinematicMoverComponent::GetTargetPosition() const
+    {
+        const auto* moverSystem = KinematicMoverSystemInterface::Get();
+        return moverSystem != nullptr ? moverSystem->GetTargetPosition(GetEntityId()) : 0.f;
+    }
+    bool KinematicMoverComponent::GetIsMoving() const
+    {
+        const auto* moverSystem = KinematicMoverSystemInterface::Get();
+        return moverSystem != nullptr && moverSystem->GetIsMoving(GetEntityId());
+    }
+    float KinematicMoverComponent::GetTravelTime() const
+    {
+        return m_travelTime;
+    }
+    void KinematicMoverComponent::SetTravelTime(const float& new_travelTime)
+    {
+        m_travelTime = AZ::GetMax(new_travelTime, 0.f);
+        if(auto* moverSystem = KinematicMoverSystemInterface::Get())
+            moverSystem->SetTravelTime(GetEntityId(), m_travelTime);
+    }
+} // namespace FirstPersonController
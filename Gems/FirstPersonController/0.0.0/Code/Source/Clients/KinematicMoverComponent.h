@@ -0,0 +1,49 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+#include <FirstPersonController/KinematicMoverComponentBus.h>
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace FirstPersonController
+{
+    // Registers a kinematic level piece (elevator, door, platform) with the kinematic mover system,
+    // which moves it between its start pose and an end pose relative to it
+    class KinematicMoverComponent
+        : public AZ::Component
+        , public KinematicMoverComponentRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(KinematicMoverComponent, "{d8b1a4f2-6e07-4c39-95d3-2f8c7e61a0b4}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // KinematicMoverComponentRequestBus
+        void GoTo(const float& new_targetPosition) override;
+        void Stop() override;
+        float GetPosition() const override;
+        float GetTargetPosition() const override;
+        bool GetIsMoving() const override;
+        float GetTravelTime() const override;
+        void SetTravelTime(const float& new_travelTime) override;
+
+    private:
+        // Kinematic mover settings
+        AZ::Vector3 m_endTranslationOffset = AZ::Vector3(0.f, 0.f, 3.f);
+        AZ::Vector3 m_endRotationDegrees = AZ::Vector3::CreateZero();
+        float m_travelTime = 2.f;
+        KinematicMoverEasing m_easing = KinematicMoverEasing::SmoothStep;
+        float m_initialPosition = 0.f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,296 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/KinematicMoverSystem.h>
+#include <Clients/PhysicsSceneLookup.h>
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/RigidBody.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
+
+namespace FirstPersonController
+{
+    KinematicMoverSystem::KinematicMoverSystem()
+    {
+        if(KinematicMoverSystemInterface::Get() == nullptr)
+            KinematicMoverSystemInterface::Register(this);
+    }
+
+    KinematicMoverSystem::~KinematicMoverSystem()
+    {
+        Clear();
+        if(KinematicMoverSystemInterface::Get() == this)
+            KinematicMoverSystemInterface::Unregister(this);
+    }
+
+    void KinematicMoverSystem::AddMover(const AZ::EntityId& entityId, const AZ::Transform& startTM, const AZ::Transform& endTM,
+        const float& travelTime, const KinematicMoverEasing& easing, const float& position)
+    {
+        RemoveMover(entityId);
+
+        Mover mover;
+        mover.m_entityId = entityId;
+        mover.m_startTranslation = startTM.GetTranslation();
+        mover.m_endTranslation = endTM.GetTranslation();
+        mover.m_startRotation = startTM.GetRotation();
+        mover.m_endRotation = endTM.GetRotation();
+        mover.m_uniformScale = startTM.GetUniformScale();
+        mover.m_inverseTravelTime = travelTime > 0.f ? 1.f / travelTime : 0.f;
+        mover.m_position = AZ::GetClamp(position, 0.f, 1.f);
+        mover.m_targetPosition = mover.m_position;
+        mover.m_easing = easing;
+
+        Physics::RigidBodyRequestBus::EventResult(mover.m_body, entityId, &Physics::RigidBodyRequests::GetRigidBody);
+        if(mover.m_body == nullptr || !mover.m_body->IsKinematic())
+        {
+            AZ_Warning("Kinematic Mover System", false, "Entity %s needs a kinematic rigid body to be moved.", entityId.ToString().c_str());
+            mover.m_body = nullptr;
+        }
+
+        // Movers without a body have nothing to move in a scene, they are only stepped by calls to Step() for every scene
+        if(mover.m_body != nullptr)
+            mover.m_sceneHandle = GetEntityPhysicsScene(entityId);
+
+        m_moverIndices[entityId] = m_movers.size();
+        m_movers.push_back(mover);
+
+        if(mover.m_body != nullptr)
+            ConnectToScene(mover.m_sceneHandle);
+    }
+
+    void KinematicMoverSystem::RemoveMover(const AZ::EntityId& entityId)
+    {
+        auto moverIndex = m_moverIndices.find(entityId);
+        if(moverIndex == m_moverIndices.end())
+            return;
+
+        const size_t index = moverIndex->second;
+        const size_t lastIndex = m_movers.size() - 1;
+        m_moverIndices.erase(moverIndex);
+
+        m_activeMovers.erase(AZStd::remove(m_activeMovers.begin(), m_activeMovers.end(), index), m_activeMovers.end());
+
+        // Move the last mover into the freed slot and update the indices referring to it
+        if(index != lastIndex)
+        {
+            m_movers[index] = m_movers[lastIndex];
+            m_moverIndices[m_movers[index].m_entityId] = index;
+            for(size_t& activeIndex : m_activeMovers)
+                if(activeIndex == lastIndex)
+                    activeIndex = index;
+        }
+        m_movers.pop_back();
+    }
+
+    void KinematicMoverSystem::Clear()
+    {
+        m_movers.clear();
+        m_moverIndices.clear();
+        m_activeMovers.clear();
+        m_settlingEntityIds.clear();
+        m_arrivedEntityIds.clear();
+        m_sceneConnections.clear();
+    }
+
+    void KinematicMoverSystem::GoTo(const AZ::EntityId& entityId, const float& targetPosition)
+    {
+        auto moverIndex = m_moverIndices.find(entityId);
+        if(moverIndex == m_moverIndices.end())
+            return;
+
+        Mover& mover = m_movers[moverIndex->second];
+        mover.m_targetPosition = AZ::GetClamp(targetPosition, 0.f, 1.f);
+        if(mover.m_targetPosition == mover.m_position)
+            return;
+
+        if(!mover.m_active)
+        {
+            mover.m_active = true;
+            m_activeMovers.push_back(moverIndex->second);
+            // A mover that arrived on the last step is still awake
+            if(mover.m_body != nullptr && !mover.m_settling)
+                mover.m_body->ForceAwake();
+            mover.m_settling = false;
+        }
+
+        KinematicMoverNotificationBus::Event(entityId, &KinematicMoverNotificationBus::Events::OnMoverStarted, mover.m_targetPosition);
+    }
+
+    void KinematicMoverSystem::Stop(const AZ::EntityId& entityId)
+    {
+        auto moverIndex = m_moverIndices.find(entityId);
+        if(moverIndex == m_moverIndices.end())
+            return;
+
+        Mover& mover = m_movers[moverIndex->second];
+        mover.m_targetPosition = mover.m_position;
+    }
+
+    float KinematicMoverSystem::GetPosition(const AZ::EntityId& entityId) const
+    {
+        auto moverIndex = m_moverIndices.find(entityId);
+        return moverIndex != m_moverIndices.end() ? m_movers[moverIndex->second].m_position : 0.f;
+    }
+
+    float KinematicMoverSystem::GetTargetPosition(const AZ::EntityId& entityId) const
+    {
+        auto moverIndex = m_moverIndices.find(entityId);
+        return moverIndex != m_moverIndices.end() ? m_movers[moverIndex->second].m_targetPosition : 0.f;
+    }
+
+    bool KinematicMoverSystem::GetIsMoving(const AZ::EntityId& entityId) const
+    {
+        auto moverIndex = m_moverIndices.find(entityId);
+        return moverIndex != m_moverIndices.end() && m_movers[moverIndex->second].m_active;
+    }
+
+    void KinematicMoverSystem::SetTravelTime(const AZ::EntityId& entityId, const float& travelTime)
+    {
+        auto moverIndex = m_moverIndices.find(entityId);
+        if(moverIndex != m_moverIndices.end())
+            m_movers[moverIndex->second].m_inverseTravelTime = travelTime > 0.f ? 1.f / travelTime : 0.f;
+    }
+
+    AZ::u32 KinematicMoverSystem::GetMoverCount() const
+    {
+        return static_cast<AZ::u32>(m_movers.size());
+    }
+
+    AZ::u32 KinematicMoverSystem::GetActiveMoverCount() const
+    {
+        return static_cast<AZ::u32>(m_activeMovers.size());
+    }
+
+    AZ::u32 KinematicMoverSystem::GetSettlingMoverCount() const
+    {
+        AZ::u32 settlingCount = 0;
+        for(const Mover& mover : m_movers)
+            if(mover.m_settling)
+                ++settlingCount;
+        return settlingCount;
+    }
+
+    void KinematicMoverSystem::Step(const float& deltaTime, const AzPhysics::SceneHandle& sceneHandle)
+    {
+        SettleArrivedMovers(sceneHandle);
+
+        if(m_activeMovers.empty())
+            return;
+
+        m_arrivedEntityIds.clear();
+
+        size_t activeCount = 0;
+        for(const size_t& index : m_activeMovers)
+        {
+            Mover& mover = m_movers[index];
+            if(sceneHandle != AzPhysics::InvalidSceneHandle && mover.m_sceneHandle != sceneHandle)
+            {
+                m_activeMovers[activeCount++] = index;
+                continue;
+            }
+
+            // A travel time of zero snaps to the target
+            const float maxStep = mover.m_inverseTravelTime > 0.f ? deltaTime * mover.m_inverseTravelTime : 1.f;
+            const float remaining = mover.m_targetPosition - mover.m_position;
+            if(AZ::GetAbs(remaining) <= maxStep)
+                mover.m_position = mover.m_targetPosition;
+            else
+                mover.m_position += remaining > 0.f ? maxStep : -maxStep;
+
+            if(mover.m_body != nullptr)
+                mover.m_body->SetKinematicTarget(GetPose(mover));
+
+            if(mover.m_position == mover.m_targetPosition)
+            {
+                mover.m_active = false;
+                mover.m_settling = true;
+                m_settlingEntityIds.push_back(mover.m_entityId);
+                m_arrivedEntityIds.push_back(mover.m_entityId);
+            }
+            else
+                m_activeMovers[activeCount++] = index;
+        }
+        m_activeMovers.resize(activeCount);
+
+        // Arrivals are sent once stepping is done since handlers may issue new commands,
+        // the list is indexed since a handler clearing the system also empties it
+        for(size_t i = 0; i < m_arrivedEntityIds.size(); ++i)
+        {
+            const AZ::EntityId entityId = m_arrivedEntityIds[i];
+            auto moverIndex = m_moverIndices.find(entityId);
+            if(moverIndex == m_moverIndices.end())
+                continue;
+
+            KinematicMoverNotificationBus::Event(entityId, &KinematicMoverNotificationBus::Events::OnMoverArrived,
+                m_movers[moverIndex->second].m_position);
+        }
+    }
+
+    void KinematicMoverSystem::SettleArrivedMovers(const AzPhysics::SceneHandle& sceneHandle)
+    {
+        // The final kinematic target was written on the previous step, so PhysX has moved the body there by now
+        size_t settlingCount = 0;
+        for(const AZ::EntityId& entityId : m_settlingEntityIds)
+        {
+            auto moverIndex = m_moverIndices.find(entityId);
+            if(moverIndex == m_moverIndices.end())
+                continue;
+
+            Mover& mover = m_movers[moverIndex->second];
+            if(!mover.m_settling)
+                continue;
+            if(sceneHandle != AzPhysics::InvalidSceneHandle && mover.m_sceneHandle != sceneHandle)
+            {
+                m_settlingEntityIds[settlingCount++] = entityId;
+                continue;
+            }
+
+            if(mover.m_body != nullptr)
+                mover.m_body->ForceAsleep();
+            mover.m_settling = false;
+        }
+        m_settlingEntityIds.resize(settlingCount);
+    }
+
+    AZ::Transform KinematicMoverSystem::GetPose(const Mover& mover) const
+    {
+        float t = mover.m_position;
+        if(mover.m_easing == KinematicMoverEasing::SmoothStep)
+            t = t * t * (3.f - 2.f * t);
+
+        return AZ::Transform(mover.m_startTranslation.Lerp(mover.m_endTranslation, t),
+            mover.m_startRotation.Slerp(mover.m_endRotation, t), mover.m_uniformScale);
+    }
+
+    void KinematicMoverSystem::ConnectToScene(const AzPhysics::SceneHandle& sceneHandle)
+    {
+        if(sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            AZ_Error("Kinematic Mover System", false, "Failed to retrieve the physics scene.");
+            return;
+        }
+
+        for(const AZStd::unique_ptr<SceneConnection>& sceneConnection : m_sceneConnections)
+            if(sceneConnection->m_sceneHandle == sceneHandle)
+                return;
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if(sceneInterface == nullptr)
+            return;
+
+        m_sceneConnections.push_back(AZStd::make_unique<SceneConnection>());
+        SceneConnection& sceneConnection = *m_sceneConnections.back();
+        sceneConnection.m_sceneHandle = sceneHandle;
+        sceneConnection.m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+            [this](AzPhysics::SceneHandle simulatedSceneHandle, float fixedDeltaTime)
+            {
+                Step(fixedDeltaTime, simulatedSceneHandle);
+            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
+
+        sceneInterface->RegisterSceneSimulationStartHandler(sceneHandle, sceneConnection.m_sceneSimulationStartHandler);
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,100 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <FirstPersonController/KinematicMoverComponentBus.h>
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+
+namespace AzPhysics
+{
+    class RigidBody;
+}
+
+namespace FirstPersonController
+{
+    // Owns the start and end poses and the targets of every kinematic mover, and steps the moving ones together
+    // once per physics step by writing kinematic targets that PhysX interpolates. Movers that reach their target
+    // leave the active list, and their bodies are put to sleep on the following step once PhysX has moved them
+    // to the final target.
+    class KinematicMoverSystem
+        : public KinematicMoverSystemRequests
+    {
+    public:
+        AZ_RTTI(KinematicMoverSystem, "{62a0f3c8-b91d-4e57-8c2a-d7e4051b9f36}", KinematicMoverSystemRequests);
+
+        KinematicMoverSystem();
+        ~KinematicMoverSystem() override;
+
+        // KinematicMoverSystemRequests interface
+        void AddMover(const AZ::EntityId& entityId, const AZ::Transform& startTM, const AZ::Transform& endTM,
+            const float& travelTime, const KinematicMoverEasing& easing, const float& position) override;
+        void RemoveMover(const AZ::EntityId& entityId) override;
+
+        void GoTo(const AZ::EntityId& entityId, const float& targetPosition) override;
+        void Stop(const AZ::EntityId& entityId) override;
+        float GetPosition(const AZ::EntityId& entityId) const override;
+        float GetTargetPosition(const AZ::EntityId& entityId) const override;
+        bool GetIsMoving(const AZ::EntityId& entityId) const override;
+        void SetTravelTime(const AZ::EntityId& entityId, const float& travelTime) override;
+
+        AZ::u32 GetMoverCount() const override;
+        AZ::u32 GetActiveMoverCount() const override;
+
+        void Clear();
+        // Movers that arrived on the last step and are put to sleep on the next one
+        AZ::u32 GetSettlingMoverCount() const;
+
+        // Advances the active movers in the physics scene by deltaTime and writes their kinematic targets,
+        // an invalid scene handle steps the movers of every scene
+        void Step(const float& deltaTime, const AzPhysics::SceneHandle& sceneHandle = AzPhysics::InvalidSceneHandle);
+
+    private:
+        struct Mover
+        {
+            AZ::EntityId m_entityId;
+            AzPhysics::RigidBody* m_body = nullptr;
+            AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+            AZ::Vector3 m_startTranslation = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_endTranslation = AZ::Vector3::CreateZero();
+            AZ::Quaternion m_startRotation = AZ::Quaternion::CreateIdentity();
+            AZ::Quaternion m_endRotation = AZ::Quaternion::CreateIdentity();
+            float m_uniformScale = 1.f;
+            float m_inverseTravelTime = 1.f;
+            float m_position = 0.f;
+            float m_targetPosition = 0.f;
+            KinematicMoverEasing m_easing = KinematicMoverEasing::Linear;
+            bool m_active = false;
+            bool m_settling = false;
+        };
+
+        AZ::Transform GetPose(const Mover& mover) const;
+        void ConnectToScene(const AzPhysics::SceneHandle& sceneHandle);
+        void SettleArrivedMovers(const AzPhysics::SceneHandle& sceneHandle);
+
+        // Movers are stored densely, with the moving ones referenced from a separate list stepped each physics step
+        AZStd::vector<Mover> m_movers;
+        AZStd::unordered_map<AZ::EntityId, size_t> m_moverIndices;
+        AZStd::vector<size_t> m_activeMovers;
+        AZStd::vector<AZ::EntityId> m_settlingEntityIds;
+        // Movers that arrived during the current step, kept as a member so that stepping doesn't allocate
+        AZStd::vector<AZ::EntityId> m_arrivedEntityIds;
+
+        // One simulation start handler per physics scene with movers in it, heap allocated so that the handlers don't move
+        struct SceneConnection
+        {
+            AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+            AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimulationStartHandler;
+        };
+        AZStd::vector<AZStd::unique_ptr<SceneConnection>> m_sceneConnections;
+    };
+} // namespace FirstPersonController
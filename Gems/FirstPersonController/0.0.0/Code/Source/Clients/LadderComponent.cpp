@@ -0,0 +1,221 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/LadderComponent.h>
+#include <Clients/PhysicsSceneLookup.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
+
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
+#include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
+
+namespace FirstPersonController
+{
+    void LadderComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<LadderComponent, AZ::Component>()
+              ->Field("Climb Speed Scale", &LadderComponent::m_climbSpeedScale)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Class<LadderComponent>("Ladder",
+                    "Turns a PhysX trigger collider into a ladder volume that First Person Controllers climb while inside it")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller")
+                    ->DataElement(nullptr,
+                        &LadderComponent::m_climbSpeedScale,
+                        "Climb Speed Scale", "Factor applied to the controller's Ladder Climb Speed while it climbs this ladder.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f);
+            }
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->EBus<LadderComponentRequestBus>("LadderComponentRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Get Climb Speed Scale", &LadderComponentRequests::GetClimbSpeedScale)
+                ->Event("Set Climb Speed Scale", &LadderComponentRequests::SetClimbSpeedScale)
+                ->Event("Get Climber Count", &LadderComponentRequests::GetClimberCount)
+                ->Event("Release Climber", &LadderComponentRequests::ReleaseClimber);
+
+            bc->Class<LadderComponent>()->RequestBus("LadderComponentRequestBus");
+        }
+    }
+
+    void LadderComponent::Activate()
+    {
+        m_onTriggerEnterHandler = AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler(
+            [this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle, const AzPhysics::TriggerEvent& triggerEvent)
+            {
+                OnTriggerEnter(triggerEvent);
+            });
+        m_onTriggerExitHandler = AzPhysics::SimulatedBodyEvents::OnTriggerExit::Handler(
+            [this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle, const AzPhysics::TriggerEvent& triggerEvent)
+            {
+                OnTriggerExit(triggerEvent);
+            });
+
+        AzPhysics::SimulatedBodyHandle bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(bodyHandle, GetEntityId(),
+            &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBodyHandle);
+        const AzPhysics::SceneHandle sceneHandle = GetEntityPhysicsScene(GetEntityId());
+
+        if(bodyHandle == AzPhysics::InvalidSimulatedBodyHandle || sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            AZ_Warning("Ladder Component", false, "No simulated body was found on the ladder entity, the ladder volume requires a PhysX trigger collider.");
+        }
+        else
+        {
+            AzPhysics::SimulatedBodyEvents::RegisterOnTriggerEnterHandler(sceneHandle, bodyHandle, m_onTriggerEnterHandler);
+            AzPhysics::SimulatedBodyEvents::RegisterOnTriggerExitHandler(sceneHandle, bodyHandle, m_onTriggerExitHandler);
+        }
+
+        LadderComponentRequestBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void LadderComponent::Deactivate()
+    {
+        LadderComponentRequestBus::Handler::BusDisconnect();
+        AZ::TickBus::Handler::BusDisconnect();
+
+        m_onTriggerEnterHandler.Disconnect();
+        m_onTriggerExitHandler.Disconnect();
+
+        // Release anyone still climbing, since no exit event will arrive for them
+        for(const AZ::EntityId& climberEntityId : m_climbers)
+            FirstPersonControllerComponentRequestBus::Event(climberEntityId,
+                &FirstPersonControllerComponentRequestBus::Events::ExitLadder, GetEntityId());
+        m_climbers.clear();
+        m_occupants.clear();
+    }
+
+    void LadderComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("TransformService"));
+        required.push_back(AZ_CRC_CE("PhysicsTriggerService"));
+    }
+
+    void LadderComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        // The simulated body needs to exist before the trigger handlers are registered
+        dependent.push_back(AZ_CRC_CE("PhysicsWorldBodyService"));
+    }
+
+    void LadderComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("LadderService"));
+    }
+
+    void LadderComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("LadderService"));
+    }
+
+    void LadderComponent::OnTriggerEnter(const AzPhysics::TriggerEvent& triggerEvent)
+    {
+        if(triggerEvent.m_otherBody == nullptr)
+            return;
+
+        const AZ::EntityId otherEntityId = triggerEvent.m_otherBody->GetEntityId();
+        if(!FirstPersonControllerComponentRequestBus::HasHandlers(otherEntityId))
+            return;
+
+        // A character made of several shapes only counts once
+        if(AZStd::find(m_occupants.begin(), m_occupants.end(), otherEntityId) != m_occupants.end())
+            return;
+
+        m_occupants.push_back(otherEntityId);
+        if(!GrabLadder(otherEntityId))
+            AZ::TickBus::Handler::BusConnect();
+    }
+
+    void LadderComponent::OnTriggerExit(const AzPhysics::TriggerEvent& triggerEvent)
+    {
+        if(triggerEvent.m_otherBody == nullptr)
+            return;
+
+        const AZ::EntityId otherEntityId = triggerEvent.m_otherBody->GetEntityId();
+        auto occupant = AZStd::find(m_occupants.begin(), m_occupants.end(), otherEntityId);
+        if(occupant == m_occupants.end())
+            return;
+
+        m_occupants.erase(occupant);
+        auto climber = AZStd::find(m_climbers.begin(), m_climbers.end(), otherEntityId);
+        if(climber != m_climbers.end())
+            m_climbers.erase(climber);
+
+        // The controller ignores this when it is no longer climbing this ladder
+        FirstPersonControllerComponentRequestBus::Event(otherEntityId,
+            &FirstPersonControllerComponentRequestBus::Events::ExitLadder, GetEntityId());
+
+        if(m_climbers.size() == m_occupants.size())
+            AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    bool LadderComponent::GrabLadder(const AZ::EntityId& occupantEntityId)
+    {
+        // A character climbing an overlapping ladder keeps climbing it
+        bool climbing = false;
+        FirstPersonControllerComponentRequestBus::EventResult(climbing, occupantEntityId,
+            &FirstPersonControllerComponentRequestBus::Events::GetClimbingLadder);
+        if(climbing)
+            return false;
+
+        FirstPersonControllerComponentRequestBus::Event(occupantEntityId,
+            &FirstPersonControllerComponentRequestBus::Events::EnterLadder, GetEntityId());
+
+        AZ::EntityId ladderEntityId;
+        FirstPersonControllerComponentRequestBus::EventResult(ladderEntityId, occupantEntityId,
+            &FirstPersonControllerComponentRequestBus::Events::GetLadderEntityId);
+        if(ladderEntityId != GetEntityId())
+            return false;
+
+        m_climbers.push_back(occupantEntityId);
+        return true;
+    }
+
+    void LadderComponent::OnTick([[maybe_unused]] float deltaTime, AZ::ScriptTimePoint)
+    {
+        for(const AZ::EntityId& occupantEntityId : m_occupants)
+            if(AZStd::find(m_climbers.begin(), m_climbers.end(), occupantEntityId) == m_climbers.end())
+                GrabLadder(occupantEntityId);
+
+        if(m_climbers.size() == m_occupants.size())
+            AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    // Request Bus getter and setter methods for use in scripts
+    float LadderComponent::GetClimbSpeedScale() const
+    {
+        return m_climbSpeedScale;
+    }
+    void LadderComponent::SetClimbSpeedScale(const float& new_climbSpeedScale)
+    {
+        m_climbSpeedScale = AZ::GetMax(new_climbSpeedScale, 0.f);
+    }
+    AZ::u32 LadderComponent::GetClimberCount() const
+    {
+        return static_cast<AZ::u32>(m_climbers.size());
+    }
+    void LadderComponent::ReleaseClimber(const AZ::EntityId& climberEntityId)
+    {
+        auto climber = AZStd::find(m_climbers.begin(), m_climbers.end(), climberEntityId);
+        if(climber == m_climbers.end())
+            return;
+
+        m_climbers.erase(climber);
+        AZ::TickBus::Handler::BusConnect();
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,63 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+#include <FirstPersonController/LadderComponentBus.h>
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
+
+namespace FirstPersonController
+{
+    // Marks a trigger volume as a ladder. Characters entering the volume are put into the controller's
+    // climb mode and taken out of it when they leave. A character inside the volume that isn't climbing,
+    // e.g. after jumping off, is offered the ladder each tick until it grabs it again.
+    class LadderComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public LadderComponentRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(LadderComponent, "{5c2e9f71-b84a-4d06-93e1-7a0d6b3f28c5}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // AZ::TickBus interface
+        void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
+
+        // LadderComponentRequestBus
+        float GetClimbSpeedScale() const override;
+        void SetClimbSpeedScale(const float& new_climbSpeedScale) override;
+        AZ::u32 GetClimberCount() const override;
+        void ReleaseClimber(const AZ::EntityId& climberEntityId) override;
+
+    private:
+        void OnTriggerEnter(const AzPhysics::TriggerEvent& triggerEvent);
+        void OnTriggerExit(const AzPhysics::TriggerEvent& triggerEvent);
+        // Puts the occupant into climb mode, returns false when the controller doesn't accept the ladder
+        bool GrabLadder(const AZ::EntityId& occupantEntityId);
+
+        // Ladder settings
+        float m_climbSpeedScale = 1.f;
+
+        // Controllers currently inside the volume, and those of them climbing it
+        AZStd::vector<AZ::EntityId> m_occupants;
+        AZStd::vector<AZ::EntityId> m_climbers;
+
+        AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler m_onTriggerEnterHandler;
+        AzPhysics::SimulatedBodyEvents::OnTriggerExit::Handler m_onTriggerExitHandler;
+    };
+} // namespace FirstPersonController
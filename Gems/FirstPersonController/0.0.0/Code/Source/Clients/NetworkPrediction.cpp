@@ -0,0 +1,148 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/NetworkPrediction.h>
+
+namespace FirstPersonController
+{
+    namespace
+    {
+        // The input frames are delta compressed against an idle input, so the channels at rest cost one bit each
+        const ControllerSnapshot IdleInput;
+        const SnapshotQuantization InputQuantization;
+    } // namespace
+
+    ControllerSnapshot QuantizeInput(const ControllerSnapshot& input)
+    {
+        return ControllerSnapshotSerializer::Quantize(input, InputQuantization);
+    }
+
+    void PackInputFrame(const ControllerSnapshot& input, InputFrame& frame)
+    {
+        frame.m_data.clear();
+        BitWriter writer(frame.m_data);
+        ControllerSnapshotSerializer::Serialize(input, &IdleInput, InputQuantization, writer);
+    }
+
+    bool UnpackInputFrame(const InputFrame& frame, ControllerSnapshot& input)
+    {
+        BitReader reader(frame.m_data.data(), static_cast<AZ::u32>(frame.m_data.size()));
+        return ControllerSnapshotSerializer::Deserialize(input, &IdleInput, InputQuantization, reader);
+    }
+
+    void PredictedMoveHistory::Push(const AZ::u16& sequence, const ControllerSnapshot& input, const AZ::Vector3& positionBefore,
+        const AZ::u32& historySize)
+    {
+        PredictedMove move;
+        move.m_sequence = sequence;
+        move.m_input = input;
+        move.m_positionBefore = positionBefore;
+        m_moves.push_back(move);
+
+        while(m_moves.size() > historySize)
+            m_moves.pop_front();
+    }
+
+    bool PredictedMoveHistory::CompleteLastMove(const float& heading, const AZ::Vector3& positionAfter, InputFrame& frame)
+    {
+        if(m_moves.empty() || m_moves.back().m_stepped)
+            return false;
+
+        PredictedMove& move = m_moves.back();
+        move.m_input.m_heading = heading;
+        move.m_positionAfter = positionAfter;
+        move.m_stepped = true;
+
+        frame.m_sequence = move.m_sequence;
+        PackInputFrame(move.m_input, frame);
+        return true;
+    }
+
+    bool PredictedMoveHistory::Reconcile(const StateFrame& state, const float& tolerance, AZ::Vector3& correctedPosition,
+        AZ::u32& replayedMoves)
+    {
+        replayedMoves = 0;
+
+        // Moves older than the acknowledged one will never be acknowledged
+        while(!m_moves.empty() && SequenceMoreRecent(state.m_ackSequence, m_moves.front().m_sequence))
+            m_moves.pop_front();
+
+        if(m_moves.empty() || m_moves.front().m_sequence != state.m_ackSequence || !m_moves.front().m_stepped)
+            return false;
+
+        const PredictedMove acknowledgedMove = m_moves.front();
+        m_moves.pop_front();
+
+        if(acknowledgedMove.m_positionAfter.GetDistance(state.m_position) <= tolerance)
+            return false;
+
+        // PhysX moves the character asynchronously, so each replayed move reapplies the displacement that was predicted for it
+        correctedPosition = state.m_position;
+        for(PredictedMove& move : m_moves)
+        {
+            if(move.m_stepped)
+            {
+                const AZ::Vector3 displacement = move.m_positionAfter - move.m_positionBefore;
+                move.m_positionBefore = correctedPosition;
+                correctedPosition += displacement;
+                move.m_positionAfter = correctedPosition;
+                ++replayedMoves;
+            }
+            else
+                move.m_positionBefore = correctedPosition;
+        }
+        return true;
+    }
+
+    bool PredictedMoveHistory::IsCaughtUp() const
+    {
+        return m_moves.empty() || (m_moves.size() == 1 && !m_moves.front().m_stepped);
+    }
+
+    AZ::u32 PredictedMoveHistory::GetCount() const
+    {
+        return static_cast<AZ::u32>(m_moves.size());
+    }
+
+    void PredictedMoveHistory::Clear()
+    {
+        m_moves.clear();
+    }
+
+    bool ReceivedInputQueue::Push(const InputFrame& frame, const AZ::u32& historySize)
+    {
+        // Drop frames that arrive out of order
+        const AZ::u16 lastSequence = m_frames.empty() ? m_lastPoppedSequence : m_frames.back().m_sequence;
+        if((m_popped || !m_frames.empty()) && !SequenceMoreRecent(frame.m_sequence, lastSequence))
+            return false;
+
+        m_frames.push_back(frame);
+        while(m_frames.size() > historySize)
+            m_frames.pop_front();
+        return true;
+    }
+
+    bool ReceivedInputQueue::Pop(InputFrame& frame)
+    {
+        if(m_frames.empty())
+            return false;
+
+        frame = m_frames.front();
+        m_frames.pop_front();
+        m_lastPoppedSequence = frame.m_sequence;
+        m_popped = true;
+        return true;
+    }
+
+    AZ::u16 ReceivedInputQueue::GetLastPoppedSequence() const
+    {
+        return m_lastPoppedSequence;
+    }
+
+    void ReceivedInputQueue::Clear()
+    {
+        m_frames.clear();
+        m_popped = false;
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,71 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <FirstPersonController/FirstPersonControllerNetworkComponentBus.h>
+
+#include <Clients/FirstPersonControllerSerializer.h>
+
+#include <AzCore/std/containers/deque.h>
+
+namespace FirstPersonController
+{
+    // Returns the input values and heading as the authority unpacks them from an input frame,
+    // the autonomous controller predicts with these so that both sides step with the same input
+    ControllerSnapshot QuantizeInput(const ControllerSnapshot& input);
+    void PackInputFrame(const ControllerSnapshot& input, InputFrame& frame);
+    bool UnpackInputFrame(const InputFrame& frame, ControllerSnapshot& input);
+
+    // Moves predicted by the autonomous controller which have not yet been acknowledged by the authority
+    class PredictedMoveHistory
+    {
+    public:
+        // Adds the move captured at the start of a tick, the oldest moves are dropped beyond historySize
+        void Push(const AZ::u16& sequence, const ControllerSnapshot& input, const AZ::Vector3& positionBefore, const AZ::u32& historySize);
+        // Completes the last move with the heading it moved along and the position it resulted in, and packs it into frame.
+        // Returns false when there is no move waiting to be completed.
+        bool CompleteLastMove(const float& heading, const AZ::Vector3& positionAfter, InputFrame& frame);
+
+        // Drops the moves acknowledged by the state. Returns true when the acknowledged move's predicted position is further
+        // than the tolerance from the authoritative one, correctedPosition is then the authoritative position with the
+        // displacements of the unacknowledged moves replayed on top of it. The inputs of those moves aren't simulated again,
+        // so a displacement the authority would have blocked is only corrected once the authority acknowledges that move.
+        bool Reconcile(const StateFrame& state, const float& tolerance, AZ::Vector3& correctedPosition, AZ::u32& replayedMoves);
+        // True when no stepped move is left to replay, the authority's velocities are then current
+        bool IsCaughtUp() const;
+
+        AZ::u32 GetCount() const;
+        void Clear();
+
+    private:
+        struct PredictedMove
+        {
+            AZ::u16 m_sequence = 0;
+            ControllerSnapshot m_input;
+            AZ::Vector3 m_positionBefore = AZ::Vector3::CreateZero();
+            AZ::Vector3 m_positionAfter = AZ::Vector3::CreateZero();
+            bool m_stepped = false;
+        };
+        AZStd::deque<PredictedMove> m_moves;
+    };
+
+    // Input frames received by the authority, stepped one per tick in sequence order
+    class ReceivedInputQueue
+    {
+    public:
+        // Returns false and drops the frame when it isn't more recent than the frames already received or stepped
+        bool Push(const InputFrame& frame, const AZ::u32& historySize);
+        // Returns false when no frame is waiting, the authority then keeps stepping with the last input
+        bool Pop(InputFrame& frame);
+
+        AZ::u16 GetLastPoppedSequence() const;
+        void Clear();
+
+    private:
+        AZStd::deque<InputFrame> m_frames;
+        AZ::u16 m_lastPoppedSequence = 0;
+        bool m_popped = false;
+    };
+} // namespace FirstPersonController
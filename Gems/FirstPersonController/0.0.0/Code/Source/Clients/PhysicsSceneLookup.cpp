@@ -0,0 +1,39 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/PhysicsSceneLookup.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+
+#include <AzCore/Interface/Interface.h>
+
+#include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
+#include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/SystemBus.h>
+
+namespace FirstPersonController
+{
+    AzPhysics::SceneHandle GetEntityPhysicsScene(const AZ::EntityId& entityId)
+    {
+        AZStd::string querySceneName;
+        FirstPersonControllerComponentRequestBus::EventResult(querySceneName, entityId,
+            &FirstPersonControllerComponentRequests::GetQuerySceneName);
+        if(!querySceneName.empty())
+        {
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            return sceneInterface != nullptr ? sceneInterface->GetSceneHandle(querySceneName) : AzPhysics::InvalidSceneHandle;
+        }
+
+        AzPhysics::SimulatedBody* body = nullptr;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(body, entityId,
+            &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBody);
+        if(body != nullptr && body->m_sceneOwner != AzPhysics::InvalidSceneHandle)
+            return body->m_sceneOwner;
+
+        AzPhysics::SceneHandle sceneHandle = AzPhysics::InvalidSceneHandle;
+        Physics::DefaultWorldBus::BroadcastResult(sceneHandle, &Physics::DefaultWorldRequests::GetDefaultSceneHandle);
+        return sceneHandle;
+    }
+} // namespace FirstPersonController
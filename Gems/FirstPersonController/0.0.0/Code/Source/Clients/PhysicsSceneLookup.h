@@ -0,0 +1,16 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+
+namespace FirstPersonController
+{
+    // Returns the physics scene an entity belongs to: the scene queried by the First Person Controller on the entity when
+    // it names one, otherwise the scene of the entity's simulated body, and the default scene for entities without either
+    AzPhysics::SceneHandle GetEntityPhysicsScene(const AZ::EntityId& entityId);
+} // namespace FirstPersonController
@@ -0,0 +1,62 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/PlatformVelocity.h>
+
+namespace FirstPersonController
+{
+    AZ::Vector3 PlatformVelocityTracker::GetPointVelocity(const AZ::Vector3& linearVelocity, const AZ::Vector3& angularVelocity,
+        const AZ::Vector3& centerOfMass, const AZ::Vector3& point)
+    {
+        return linearVelocity + angularVelocity.Cross(point - centerOfMass);
+    }
+
+    AZ::Vector3 PlatformVelocityTracker::Update(const AZ::EntityId& platformEntityId, const AZ::Transform& platformTM,
+        const AZ::Vector3& point, const float& deltaTime)
+    {
+        AZ::Vector3 velocity = AZ::Vector3::CreateZero();
+        m_yawDelta = 0.f;
+
+        if(platformEntityId == m_platformEntityId && deltaTime > 0.f)
+        {
+            // Where the point would be now had it stayed attached to the platform since the last update
+            const AZ::Vector3 carriedPoint = platformTM.TransformPoint(m_prevPlatformTM.GetInverse().TransformPoint(point));
+            velocity = (carriedPoint - point) / deltaTime;
+
+            const AZ::Quaternion rotationDelta = platformTM.GetRotation() * m_prevPlatformTM.GetRotation().GetInverseFull();
+            m_yawDelta = rotationDelta.GetEulerRadians().GetZ();
+        }
+
+        m_platformEntityId = platformEntityId;
+        m_prevPlatformTM = platformTM;
+        return velocity;
+    }
+
+    AZ::Vector3 PlatformVelocityTracker::Step(const AZ::EntityId& platformEntityId, const AZ::Transform& platformTM,
+        const PlatformBodyVelocity& bodyVelocity, const AZ::Vector3& point, const float& deltaTime, float& yawDelta)
+    {
+        // The transform is tracked even while the body's velocity is used, so that switching between the two doesn't jump
+        const AZ::Vector3 trackedVelocity = Update(platformEntityId, platformTM, point, deltaTime);
+
+        if(bodyVelocity.m_linearVelocity.IsZero() && bodyVelocity.m_angularVelocity.IsZero())
+        {
+            yawDelta = m_yawDelta;
+            return trackedVelocity;
+        }
+
+        yawDelta = bodyVelocity.m_angularVelocity.GetZ() * deltaTime;
+        return GetPointVelocity(bodyVelocity.m_linearVelocity, bodyVelocity.m_angularVelocity, bodyVelocity.m_centerOfMass, point);
+    }
+
+    void PlatformVelocityTracker::Reset()
+    {
+        m_platformEntityId = AZ::EntityId();
+        m_yawDelta = 0.f;
+    }
+
+    float PlatformVelocityTracker::GetYawDelta() const
+    {
+        return m_yawDelta;
+    }
+} // namespace FirstPersonController
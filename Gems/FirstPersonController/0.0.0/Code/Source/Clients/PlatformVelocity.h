@@ -0,0 +1,48 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace FirstPersonController
+{
+    // Velocity of the platform's rigid body, zero for platforms without one
+    struct PlatformBodyVelocity
+    {
+        AZ::Vector3 m_linearVelocity = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_angularVelocity = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_centerOfMass = AZ::Vector3::CreateZero();
+    };
+
+    // Tracks the pose of the entity a character stands on to obtain the velocity of the point the character is at,
+    // for platforms that are moved without a rigid body velocity (e.g. by setting their transform)
+    class PlatformVelocityTracker
+    {
+    public:
+        // Velocity of the point on a rigid body with the given linear and angular velocity
+        static AZ::Vector3 GetPointVelocity(const AZ::Vector3& linearVelocity, const AZ::Vector3& angularVelocity,
+            const AZ::Vector3& centerOfMass, const AZ::Vector3& point);
+
+        // Returns the velocity that the point attached to the platform had over the last deltaTime.
+        // Zero is returned for the first update on a platform.
+        AZ::Vector3 Update(const AZ::EntityId& platformEntityId, const AZ::Transform& platformTM, const AZ::Vector3& point,
+            const float& deltaTime);
+        // The controller's update for each step. Returns the velocity the character at point inherits, taken from the rigid body
+        // while it moves and otherwise from the change in the platform's transform. yawDelta is the platform's rotation over the step.
+        AZ::Vector3 Step(const AZ::EntityId& platformEntityId, const AZ::Transform& platformTM, const PlatformBodyVelocity& bodyVelocity,
+            const AZ::Vector3& point, const float& deltaTime, float& yawDelta);
+        void Reset();
+
+        // Rotation of the platform about the world Z axis over the last update
+        float GetYawDelta() const;
+
+    private:
+        AZ::EntityId m_platformEntityId;
+        AZ::Transform m_prevPlatformTM = AZ::Transform::CreateIdentity();
+        float m_yawDelta = 0.f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,109 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/TagIndex.h>
+
+namespace FirstPersonController
+{
+    TagIndex::~TagIndex()
+    {
+        Clear();
+    }
+
+    void TagIndex::TrackTag(const AZ::Crc32& tag)
+    {
+        GetTrackedTag(tag);
+    }
+
+    bool TagIndex::HasTag(const AZ::EntityId& entityId, const AZ::Crc32& tag)
+    {
+        const TrackedTag& trackedTag = GetTrackedTag(tag);
+        if(trackedTag.m_bit != 0)
+            return (GetEntityTagMask(entityId) & trackedTag.m_bit) != 0;
+        return trackedTag.m_entityIds.find(entityId) != trackedTag.m_entityIds.end();
+    }
+
+    const AZStd::unordered_set<AZ::EntityId>& TagIndex::GetEntities(const AZ::Crc32& tag)
+    {
+        return GetTrackedTag(tag).m_entityIds;
+    }
+
+    AZ::u64 TagIndex::GetEntityTagMask(const AZ::EntityId& entityId) const
+    {
+        auto mask = m_entityTagMasks.find(entityId);
+        return mask != m_entityTagMasks.end() ? mask->second : 0;
+    }
+
+    AZ::u64 TagIndex::GetTagBit(const AZ::Crc32& tag)
+    {
+        return GetTrackedTag(tag).m_bit;
+    }
+
+    void TagIndex::Clear()
+    {
+        LmbrCentral::TagGlobalNotificationBus::MultiHandler::BusDisconnect();
+        m_tags.clear();
+        m_entityTagMasks.clear();
+        m_assignedBitCount = 0;
+    }
+
+    TagIndex::TrackedTag& TagIndex::GetTrackedTag(const AZ::Crc32& tag)
+    {
+        auto trackedTag = m_tags.find(tag);
+        if(trackedTag != m_tags.end())
+            return trackedTag->second;
+
+        TrackedTag& newTag = m_tags[tag];
+        if(m_assignedBitCount < MaskTagCount)
+            newTag.m_bit = 1ull << m_assignedBitCount++;
+
+        // Seed the index with the entities that already have the tag, then follow additions and removals
+        AZ::EBusAggregateResults<AZ::EntityId> taggedEntities;
+        LmbrCentral::TagGlobalRequestBus::EventResult(taggedEntities, tag, &LmbrCentral::TagGlobalRequests::RequestTaggedEntities);
+        for(const AZ::EntityId& entityId : taggedEntities.values)
+        {
+            newTag.m_entityIds.insert(entityId);
+            if(newTag.m_bit != 0)
+                m_entityTagMasks[entityId] |= newTag.m_bit;
+        }
+
+        LmbrCentral::TagGlobalNotificationBus::MultiHandler::BusConnect(tag);
+        return newTag;
+    }
+
+    void TagIndex::OnEntityTagAdded(const AZ::EntityId& entityId)
+    {
+        const AZ::Crc32* tag = LmbrCentral::TagGlobalNotificationBus::GetCurrentBusId();
+        if(tag == nullptr)
+            return;
+
+        auto trackedTag = m_tags.find(*tag);
+        if(trackedTag == m_tags.end())
+            return;
+
+        trackedTag->second.m_entityIds.insert(entityId);
+        if(trackedTag->second.m_bit != 0)
+            m_entityTagMasks[entityId] |= trackedTag->second.m_bit;
+    }
+
+    void TagIndex::OnEntityTagRemoved(const AZ::EntityId& entityId)
+    {
+        const AZ::Crc32* tag = LmbrCentral::TagGlobalNotificationBus::GetCurrentBusId();
+        if(tag == nullptr)
+            return;
+
+        auto trackedTag = m_tags.find(*tag);
+        if(trackedTag == m_tags.end())
+            return;
+
+        trackedTag->second.m_entityIds.erase(entityId);
+        auto mask = m_entityTagMasks.find(entityId);
+        if(mask != m_entityTagMasks.end())
+        {
+            mask->second &= ~trackedTag->second.m_bit;
+            if(mask->second == 0)
+                m_entityTagMasks.erase(mask);
+        }
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,51 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <LmbrCentral/Scripting/TagComponentBus.h>
+
+namespace FirstPersonController
+{
+    // Tag to entity set and entity to tag bitmask index, seeded from the tag components when a tag is first tracked
+    // and maintained through TagGlobalNotificationBus afterwards
+    class TagIndex
+        : public LmbrCentral::TagGlobalNotificationBus::MultiHandler
+    {
+    public:
+        static constexpr AZ::u8 MaskTagCount = 64;
+
+        ~TagIndex() override;
+
+        void TrackTag(const AZ::Crc32& tag);
+        bool HasTag(const AZ::EntityId& entityId, const AZ::Crc32& tag);
+        const AZStd::unordered_set<AZ::EntityId>& GetEntities(const AZ::Crc32& tag);
+        AZ::u64 GetEntityTagMask(const AZ::EntityId& entityId) const;
+        AZ::u64 GetTagBit(const AZ::Crc32& tag);
+        void Clear();
+
+        // LmbrCentral::TagGlobalNotificationBus
+        void OnEntityTagAdded(const AZ::EntityId& entityId) override;
+        void OnEntityTagRemoved(const AZ::EntityId& entityId) override;
+
+    private:
+        struct TrackedTag
+        {
+            AZStd::unordered_set<AZ::EntityId> m_entityIds;
+            AZ::u64 m_bit = 0;
+        };
+
+        TrackedTag& GetTrackedTag(const AZ::Crc32& tag);
+
+        AZStd::unordered_map<AZ::Crc32, TrackedTag> m_tags;
+        AZStd::unordered_map<AZ::EntityId, AZ::u64> m_entityTagMasks;
+        AZ::u8 m_assignedBitCount = 0;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,199 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/TeleporterComponent.h>
+#include <Clients/PhysicsSceneLookup.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
+
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
+#include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
+
+namespace FirstPersonController
+{
+    void TeleporterComponent::Reflect(AZ::ReflectContext* rc)
+    {
+        if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
+        {
+            sc->Class<TeleporterComponent, AZ::Component>()
+              ->Field("Destination Entity", &TeleporterComponent::m_destinationEntityId)
+              ->Field("Match Destination Heading", &TeleporterComponent::m_matchDestinationHeading)
+              ->Version(1);
+
+            if(AZ::EditContext* ec = sc->GetEditContext())
+            {
+                using namespace AZ::Edit::Attributes;
+                ec->Class<TeleporterComponent>("Teleporter",
+                    "Teleports First Person Controllers that enter this PhysX trigger collider to the destination entity")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(Category, "First Person Controller")
+                    ->DataElement(nullptr,
+                        &TeleporterComponent::m_destinationEntityId,
+                        "Destination Entity", "Entity whose translation the character is teleported to. The character's feet are placed on the floor found near it.")
+                    ->DataElement(nullptr,
+                        &TeleporterComponent::m_matchDestinationHeading,
+                        "Match Destination Heading", "Determines whether the character is turned to face along the destination entity's forward (Y) axis.");
+            }
+        }
+
+        if(auto bc = azrtti_cast<AZ::BehaviorContext*>(rc))
+        {
+            bc->EBus<TeleporterComponentRequestBus>("TeleporterComponentRequestBus")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Event("Get Destination Entity Id", &TeleporterComponentRequests::GetDestinationEntityId)
+                ->Event("Set Destination Entity Id", &TeleporterComponentRequests::SetDestinationEntityId)
+                ->Event("Get Match Destination Heading", &TeleporterComponentRequests::GetMatchDestinationHeading)
+                ->Event("Set Match Destination Heading", &TeleporterComponentRequests::SetMatchDestinationHeading);
+
+            bc->Class<TeleporterComponent>()->RequestBus("TeleporterComponentRequestBus");
+        }
+    }
+
+    void TeleporterComponent::Activate()
+    {
+        m_onTriggerEnterHandler = AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler(
+            [this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle, const AzPhysics::TriggerEvent& triggerEvent)
+            {
+                OnTriggerEnter(triggerEvent);
+            });
+        m_onTriggerExitHandler = AzPhysics::SimulatedBodyEvents::OnTriggerExit::Handler(
+            [this]([[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle, const AzPhysics::TriggerEvent& triggerEvent)
+            {
+                OnTriggerExit(triggerEvent);
+            });
+
+        AzPhysics::SimulatedBodyHandle bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(bodyHandle, GetEntityId(),
+            &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBodyHandle);
+        const AzPhysics::SceneHandle sceneHandle = GetEntityPhysicsScene(GetEntityId());
+
+        if(bodyHandle == AzPhysics::InvalidSimulatedBodyHandle || sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            AZ_Warning("Teleporter Component", false, "No simulated body was found on the teleporter entity, the teleporter requires a PhysX trigger collider.");
+        }
+        else
+        {
+            AzPhysics::SimulatedBodyEvents::RegisterOnTriggerEnterHandler(sceneHandle, bodyHandle, m_onTriggerEnterHandler);
+            AzPhysics::SimulatedBodyEvents::RegisterOnTriggerExitHandler(sceneHandle, bodyHandle, m_onTriggerExitHandler);
+        }
+
+        TeleporterComponentRequestBus::Handler::BusConnect(GetEntityId());
+    }
+
+    void TeleporterComponent::Deactivate()
+    {
+        TeleporterComponentRequestBus::Handler::BusDisconnect();
+        AZ::TickBus::Handler::BusDisconnect();
+
+        m_onTriggerEnterHandler.Disconnect();
+        m_onTriggerExitHandler.Disconnect();
+        m_pendingEntityIds.clear();
+    }
+
+    void TeleporterComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("TransformService"));
+        required.push_back(AZ_CRC_CE("PhysicsTriggerService"));
+    }
+
+    void TeleporterComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        // The simulated body needs to exist before the trigger handlers are registered
+        dependent.push_back(AZ_CRC_CE("PhysicsWorldBodyService"));
+    }
+
+    void TeleporterComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("TeleporterService"));
+    }
+
+    void TeleporterComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("TeleporterService"));
+        incompatible.push_back(AZ_CRC_CE("LadderService"));
+    }
+
+    void TeleporterComponent::OnTick([[maybe_unused]] float deltaTime, AZ::ScriptTimePoint)
+    {
+        auto* characterTeleport = CharacterTeleportInterface::Get();
+        if(characterTeleport == nullptr || !m_destinationEntityId.IsValid() || m_pendingEntityIds.empty())
+        {
+            AZ::TickBus::Handler::BusDisconnect();
+            return;
+        }
+
+        AZ::Transform destinationTM = AZ::Transform::CreateIdentity();
+        AZ::TransformBus::EventResult(destinationTM, m_destinationEntityId, &AZ::TransformBus::Events::GetWorldTM);
+
+        // Everyone that entered since the last tick is validated and moved with one batch
+        const AZStd::vector<AZ::Vector3> positions(m_pendingEntityIds.size(), destinationTM.GetTranslation());
+        const AZStd::vector<AZ::EntityId> movedEntityIds = characterTeleport->TeleportMany(m_pendingEntityIds, positions);
+
+        for(const AZ::EntityId& movedEntityId : movedEntityIds)
+        {
+            if(m_matchDestinationHeading)
+            {
+                const AZ::Vector3 forward = destinationTM.GetBasisY();
+                const float heading = atan2f(-forward.GetX(), forward.GetY());
+                AZ::TransformBus::Event(movedEntityId, &AZ::TransformBus::Events::SetWorldRotationQuaternion,
+                    AZ::Quaternion::CreateRotationZ(heading));
+            }
+            m_pendingEntityIds.erase(AZStd::remove(m_pendingEntityIds.begin(), m_pendingEntityIds.end(), movedEntityId), m_pendingEntityIds.end());
+        }
+
+        if(m_pendingEntityIds.empty())
+            AZ::TickBus::Handler::BusDisconnect();
+    }
+
+    void TeleporterComponent::OnTriggerEnter(const AzPhysics::TriggerEvent& triggerEvent)
+    {
+        if(triggerEvent.m_otherBody == nullptr)
+            return;
+
+        const AZ::EntityId otherEntityId = triggerEvent.m_otherBody->GetEntityId();
+        if(!FirstPersonControllerComponentRequestBus::HasHandlers(otherEntityId)
+            || AZStd::find(m_pendingEntityIds.begin(), m_pendingEntityIds.end(), otherEntityId) != m_pendingEntityIds.end())
+            return;
+
+        // Teleporting from inside the simulation's trigger callback is deferred to the next tick
+        m_pendingEntityIds.push_back(otherEntityId);
+        if(!AZ::TickBus::Handler::BusIsConnected())
+            AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TeleporterComponent::OnTriggerExit(const AzPhysics::TriggerEvent& triggerEvent)
+    {
+        if(triggerEvent.m_otherBody == nullptr)
+            return;
+
+        const AZ::EntityId otherEntityId = triggerEvent.m_otherBody->GetEntityId();
+        m_pendingEntityIds.erase(AZStd::remove(m_pendingEntityIds.begin(), m_pendingEntityIds.end(), otherEntityId), m_pendingEntityIds.end());
+    }
+
+    // Request Bus getter and setter methods for use in scripts
+    AZ::EntityId TeleporterComponent::GetDestinationEntityId() const
+    {
+        return m_destinationEntityId;
+    }
+    void TeleporterComponent::SetDestinationEntityId(const AZ::EntityId& new_destinationEntityId)
+    {
+        m_destinationEntityId = new_destinationEntityId;
+    }
+    bool TeleporterComponent::GetMatchDestinationHeading() const
+    {
+        return m_matchDestinationHeading;
+    }
+    void TeleporterComponent::SetMatchDestinationHeading(const bool& new_matchDestinationHeading)
+    {
+        m_matchDestinationHeading = new_matchDestinationHeading;
+    }
+} // namespace FirstPersonController
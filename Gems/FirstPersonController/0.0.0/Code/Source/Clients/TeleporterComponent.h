@@ -0,0 +1,61 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+#include <FirstPersonController/CharacterTeleportBus.h>
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
+
+namespace FirstPersonController
+{
+    // Teleports First Person Controllers that enter the trigger volume to the destination entity. The characters
+    // that entered during a tick are teleported together on the next tick through the character teleport service,
+    // and any whose landing spot was blocked are retried until they leave the volume.
+    class TeleporterComponent
+        : public AZ::Component
+        , public AZ::TickBus::Handler
+        , public TeleporterComponentRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(TeleporterComponent, "{8e4d1b6a-3c92-47f0-b5a8-19e6d2c07f43}");
+
+        static void Reflect(AZ::ReflectContext* rc);
+
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // TickBus interface
+        void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
+
+        // TeleporterComponentRequestBus
+        AZ::EntityId GetDestinationEntityId() const override;
+        void SetDestinationEntityId(const AZ::EntityId& new_destinationEntityId) override;
+        bool GetMatchDestinationHeading() const override;
+        void SetMatchDestinationHeading(const bool& new_matchDestinationHeading) override;
+
+    private:
+        void OnTriggerEnter(const AzPhysics::TriggerEvent& triggerEvent);
+        void OnTriggerExit(const AzPhysics::TriggerEvent& triggerEvent);
+
+        // Teleporter settings
+        AZ::EntityId m_destinationEntityId;
+        bool m_matchDestinationHeading = true;
+
+        // Controllers waiting to be teleported
+        AZStd::vector<AZ::EntityId> m_pendingEntityIds;
+
+        AzPhysics::SimulatedBodyEvents::OnTriggerEnter::Handler m_onTriggerEnterHandler;
+        AzPhysics::SimulatedBodyEvents::OnTriggerExit::Handler m_onTriggerExitHandler;
+    };
+} // namespace FirstPersonController
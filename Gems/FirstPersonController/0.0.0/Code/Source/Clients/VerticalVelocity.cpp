@@ -0,0 +1,28 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <Clients/VerticalVelocity.h>
+
+namespace FirstPersonController
+{
+    void VerticalVelocity::Launch(float& velocityZ, float& prevDelta, const float& launchSpeed)
+    {
+        velocityZ = launchSpeed;
+        prevDelta = 0.f;
+    }
+
+    float VerticalVelocity::GetAirborneDelta(const float& velocityZ, const float& gravity, const float& fallingGravityFactor,
+        const float& deltaTime)
+    {
+        if(velocityZ <= 0.f)
+            return gravity * fallingGravityFactor * deltaTime;
+        return gravity * deltaTime;
+    }
+
+    void VerticalVelocity::Integrate(float& velocityZ, float& prevDelta, const float& currentDelta)
+    {
+        velocityZ += (currentDelta + prevDelta) / 2.f;
+        prevDelta = currentDelta;
+    }
+} // namespace FirstPersonController
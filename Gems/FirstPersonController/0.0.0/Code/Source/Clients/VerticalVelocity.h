@@ -0,0 +1,24 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+namespace FirstPersonController
+{
+    // Integration of the controller's vertical velocity while it is airborne
+    class VerticalVelocity
+    {
+    public:
+        // Starts a launch at the given speed. The previous delta is cleared so that the first Verlet average is a half step,
+        // which keeps the apex height independent of the frame rate.
+        static void Launch(float& velocityZ, float& prevDelta, const float& launchSpeed);
+
+        // Gravity's velocity delta for a step without a held jump, scaled by fallingGravityFactor once the character falls
+        static float GetAirborneDelta(const float& velocityZ, const float& gravity, const float& fallingGravityFactor,
+            const float& deltaTime);
+
+        // Adds the average of the current and previous deltas as described by Verlet integration, which reduces accumulated error
+        static void Integrate(float& velocityZ, float& prevDelta, const float& currentDelta);
+    };
+} // namespace FirstPersonController
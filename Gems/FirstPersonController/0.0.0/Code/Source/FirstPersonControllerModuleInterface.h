@@ -6,6 +6,15 @@
 #include <AzCore/Module/Module.h>
 #include <Clients/FirstPersonControllerSystemComponent.h>
 #include <Clients/FirstPersonControllerComponent.h>
+#include <Clients/FirstPersonControllerNetworkComponent.h>
+#include <Clients/FirstPersonCarryComponent.h>
+#include <Clients/FirstPersonInteractionComponent.h>
+#include <Clients/GrabbableComponent.h>
+#include <Clients/ImpulsePadComponent.h>
+#include <Clients/InteractableComponent.h>
+#include <Clients/KinematicMoverComponent.h>
+#include <Clients/LadderComponent.h>
+#include <Clients/TeleporterComponent.h>
 
 namespace FirstPersonController
 {
@@ -24,7 +33,16 @@ namespace FirstPersonController
             // This happens through the [MyComponent]::Reflect() function.
             m_descriptors.insert(m_descriptors.end(), {
                 FirstPersonControllerSystemComponent::CreateDescriptor(),
-                FirstPersonControllerComponent::CreateDescriptor()
+                FirstPersonControllerComponent::CreateDescriptor(),
+                FirstPersonControllerNetworkComponent::CreateDescriptor(),
+                FirstPersonInteractionComponent::CreateDescriptor(),
+                InteractableComponent::CreateDescriptor(),
+                GrabbableComponent::CreateDescriptor(),
+                FirstPersonCarryComponent::CreateDescriptor(),
+                KinematicMoverComponent::CreateDescriptor(),
+                LadderComponent::CreateDescriptor(),
+                TeleporterComponent::CreateDescriptor(),
+                ImpulsePadComponent::CreateDescriptor()
                 });
         }
 
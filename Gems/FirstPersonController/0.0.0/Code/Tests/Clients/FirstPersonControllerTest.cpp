@@ -1,4 +1,1737 @@
 
 #include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Clients/ControllerLod.h>
+#include <Clients/ControllerStepScheduler.h>
+#include <Clients/DeferredEventQueue.h>
+#include <Clients/FirstPersonControllerSerializer.h>
+#include <Clients/ImpulsePadResponse.h>
+#include <Clients/GamepadInput.h>
+#include <Clients/InputOverrideStack.h>
+#include <Clients/InteractableSpatialGrid.h>
+#include <Clients/InteractHold.h>
+#include <Clients/KinematicMoverSystem.h>
+#include <Clients/NetworkPrediction.h>
+#include <Clients/PlatformVelocity.h>
+#include <Clients/VerticalVelocity.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+
+#include <benchmark/benchmark.h>
+#endif
+
+namespace UnitTest
+{
+    using namespace FirstPersonController;
+
+    namespace
+    {
+        ControllerSnapshot CreateMovingSnapshot()
+        {
+            ControllerSnapshot snapshot;
+            snapshot.m_forwardValue = 1.f;
+            snapshot.m_rightValue = 0.6f;
+            snapshot.m_yawValue = -3.7f;
+            snapshot.m_pitchValue = 1.25f;
+            snapshot.m_sprintValue = 1.f;
+            snapshot.m_heading = 2.5f;
+            snapshot.m_pitch = -0.3f;
+            snapshot.m_applyVelocityXY = AZ::Vector2(3.2f, -1.1f);
+            snapshot.m_applyVelocityZ = -9.8f;
+            return snapshot;
+        }
+
+        void ExpectSnapshotsEqual(const ControllerSnapshot& a, const ControllerSnapshot& b)
+        {
+            EXPECT_FLOAT_EQ(a.m_forwardValue, b.m_forwardValue);
+            EXPECT_FLOAT_EQ(a.m_backValue, b.m_backValue);
+            EXPECT_FLOAT_EQ(a.m_leftValue, b.m_leftValue);
+            EXPECT_FLOAT_EQ(a.m_rightValue, b.m_rightValue);
+            EXPECT_FLOAT_EQ(a.m_yawValue, b.m_yawValue);
+            EXPECT_FLOAT_EQ(a.m_pitchValue, b.m_pitchValue);
+            EXPECT_FLOAT_EQ(a.m_sprintValue, b.m_sprintValue);
+            EXPECT_FLOAT_EQ(a.m_crouchValue, b.m_crouchValue);
+            EXPECT_FLOAT_EQ(a.m_jumpValue, b.m_jumpValue);
+            EXPECT_FLOAT_EQ(a.m_heading, b.m_heading);
+            EXPECT_FLOAT_EQ(a.m_pitch, b.m_pitch);
+            EXPECT_FLOAT_EQ(a.m_applyVelocityXY.GetX(), b.m_applyVelocityXY.GetX());
+            EXPECT_FLOAT_EQ(a.m_applyVelocityXY.GetY(), b.m_applyVelocityXY.GetY());
+            EXPECT_FLOAT_EQ(a.m_applyVelocityZ, b.m_applyVelocityZ);
+        }
+    } // namespace
+
+    class FirstPersonControllerSerializerTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(FirstPersonControllerSerializerTest, BitWriterReader_RoundTripsMixedWidths)
+    {
+        AZStd::vector<AZ::u8> buffer;
+        BitWriter writer(buffer);
+        writer.WriteBits(5, 3);
+        writer.WriteBool(true);
+        writer.WriteBits(0x1ABCD, 17);
+        writer.WriteBits(0x7FFFFFFF, 31);
+        EXPECT_EQ(writer.GetBitCount(), 52u);
+        EXPECT_EQ(buffer.size(), 7u);
+
+        BitReader reader(buffer.data(), static_cast<AZ::u32>(buffer.size()));
+        EXPECT_EQ(reader.ReadBits(3), 5u);
+        EXPECT_TRUE(reader.ReadBool());
+        EXPECT_EQ(reader.ReadBits(17), 0x1ABCDu);
+        EXPECT_EQ(reader.ReadBits(31), 0x7FFFFFFFu);
+        EXPECT_FALSE(reader.IsOverflowed());
+
+        reader.ReadBits(8);
+        EXPECT_TRUE(reader.IsOverflowed());
+    }
+
+    TEST_F(FirstPersonControllerSerializerTest, Snapshot_RoundTripsWithoutBaseline)
+    {
+        const SnapshotQuantization quantization;
+        const ControllerSnapshot snapshot = CreateMovingSnapshot();
+
+        AZStd::vector<AZ::u8> buffer;
+        BitWriter writer(buffer);
+        ControllerSnapshotSerializer::Serialize(snapshot, nullptr, quantization, writer);
+
+        ControllerSnapshot result;
+        BitReader reader(buffer.data(), static_cast<AZ::u32>(buffer.size()));
+        ASSERT_TRUE(ControllerSnapshotSerializer::Deserialize(result, nullptr, quantization, reader));
+
+        ExpectSnapshotsEqual(result, ControllerSnapshotSerializer::Quantize(snapshot, quantization));
+        EXPECT_NEAR(result.m_heading, snapshot.m_heading, 1e-3f);
+        EXPECT_NEAR(result.m_applyVelocityZ, snapshot.m_applyVelocityZ, 1e-2f);
+    }
+
+    TEST_F(FirstPersonControllerSerializerTest, Snapshot_ZeroAndLimitsAreExact)
+    {
+        SnapshotQuantization quantization;
+        quantization.m_inputValueBits = 4;
+
+        ControllerSnapshot snapshot;
+        snapshot.m_forwardValue = 1.f;
+        snapshot.m_backValue = -1.f;
+        snapshot.m_applyVelocityZ = quantization.m_velocityRange;
+
+        const ControllerSnapshot quantized = ControllerSnapshotSerializer::Quantize(snapshot, quantization);
+        EXPECT_FLOAT_EQ(quantized.m_forwardValue, 1.f);
+        EXPECT_FLOAT_EQ(quantized.m_backValue, -1.f);
+        EXPECT_FLOAT_EQ(quantized.m_leftValue, 0.f);
+        EXPECT_FLOAT_EQ(quantized.m_yawValue, 0.f);
+        EXPECT_FLOAT_EQ(quantized.m_heading, 0.f);
+        EXPECT_FLOAT_EQ(quantized.m_applyVelocityZ, quantization.m_velocityRange);
+    }
+
+    TEST_F(FirstPersonControllerSerializerTest, Snapshot_DeltaAgainstBaselineOnlyWritesChangedFields)
+    {
+        const SnapshotQuantization quantization;
+        const ControllerSnapshot baseline = CreateMovingSnapshot();
+        ControllerSnapshot snapshot = baseline;
+        snapshot.m_applyVelocityZ = -9.5f;
+
+        AZStd::vector<AZ::u8> fullBuffer;
+        BitWriter fullWriter(fullBuffer);
+        ControllerSnapshotSerializer::Serialize(snapshot, nullptr, quantization, fullWriter);
+
+        AZStd::vector<AZ::u8> deltaBuffer;
+        BitWriter deltaWriter(deltaBuffer);
+        ControllerSnapshotSerializer::Serialize(snapshot, &baseline, quantization, deltaWriter);
+
+        // One changed bit per field plus the velocity that changed
+        EXPECT_EQ(deltaWriter.GetBitCount(), static_cast<AZ::u32>(ControllerSnapshotSerializer::FieldCount + quantization.m_velocityBits));
+        EXPECT_LT(deltaBuffer.size(), fullBuffer.size());
+
+        ControllerSnapshot result;
+        BitReader reader(deltaBuffer.data(), static_cast<AZ::u32>(deltaBuffer.size()));
+        ASSERT_TRUE(ControllerSnapshotSerializer::Deserialize(result, &baseline, quantization, reader));
+        ExpectSnapshotsEqual(result, ControllerSnapshotSerializer::Quantize(snapshot, quantization));
+    }
+
+    TEST_F(FirstPersonControllerSerializerTest, Snapshot_TruncatedDataFailsToDeserialize)
+    {
+        const SnapshotQuantization quantization;
+        const ControllerSnapshot snapshot = CreateMovingSnapshot();
+
+        AZStd::vector<AZ::u8> buffer;
+        BitWriter writer(buffer);
+        ControllerSnapshotSerializer::Serialize(snapshot, nullptr, quantization, writer);
+
+        ControllerSnapshot result;
+        BitReader reader(buffer.data(), static_cast<AZ::u32>(buffer.size()) - 1);
+        EXPECT_FALSE(ControllerSnapshotSerializer::Deserialize(result, nullptr, quantization, reader));
+    }
+
+    class NetworkPredictionTest : public LeakDetectionFixture
+    {
+    };
+
+    namespace
+    {
+        // Simple stand in for the controller's movement, deterministic so both sides land on the same position
+        AZ::Vector3 StepMove(const AZ::Vector3& position, const ControllerSnapshot& input, const float& deltaTime)
+        {
+            const float speed = 5.f;
+            return position + AZ::Vector3((input.m_rightValue - input.m_leftValue) * speed * deltaTime,
+                (input.m_forwardValue - input.m_backValue) * speed * deltaTime, 0.f);
+        }
+
+        // Runs both sides over a loopback with a latency of two ticks and returns the number of corrections,
+        // which is 0 whenever the autonomous side predicts with the same input the authority steps with
+        AZ::u32 RunLoopback(const AZ::u32& ticks, const bool& authorityStepsFirst, const bool& predictWithQuantizedInput)
+        {
+            struct InFlightInput { InputFrame m_frame; AZ::u32 m_deliveryTick; };
+            struct InFlightState { StateFrame m_frame; AZ::u32 m_deliveryTick; };
+            AZStd::deque<InFlightInput> inputsInFlight;
+            AZStd::deque<InFlightState> statesInFlight;
+            const AZ::u32 latency = 2;
+            const float deltaTime = 1.f / 60.f;
+
+            PredictedMoveHistory predictedMoves;
+            AZ::u16 nextSequence = 0;
+            AZ::Vector3 autonomousPosition = AZ::Vector3::CreateZero();
+            AZ::u32 corrections = 0;
+
+            ReceivedInputQueue receivedInputs;
+            ControllerSnapshot authorityInput;
+            bool authorityHasInput = false;
+            bool stateDue = false;
+            AZ::Vector3 authorityPosition = AZ::Vector3::CreateZero();
+
+            auto stepAutonomous = [&](const AZ::u32& tick)
+            {
+                InputFrame frame;
+                if(predictedMoves.CompleteLastMove(0.f, autonomousPosition, frame))
+                    inputsInFlight.push_back({frame, tick + latency});
+
+                // Analog input that doesn't fall on a quantization step
+                ControllerSnapshot input;
+                input.m_forwardValue = 0.3f + 0.01f * static_cast<float>(tick % 7);
+                input.m_leftValue = 0.55f;
+                const ControllerSnapshot stepInput = QuantizeInput(input);
+
+                predictedMoves.Push(nextSequence++, stepInput, autonomousPosition, 64);
+                autonomousPosition = StepMove(autonomousPosition, predictWithQuantizedInput ? stepInput : input, deltaTime);
+            };
+
+            auto stepAuthority = [&](const AZ::u32& tick)
+            {
+                if(stateDue)
+                {
+                    StateFrame state;
+                    state.m_ackSequence = receivedInputs.GetLastPoppedSequence();
+                    state.m_position = authorityPosition;
+                    statesInFlight.push_back({state, tick + latency});
+                    stateDue = false;
+                }
+
+                InputFrame frame;
+                if(receivedInputs.Pop(frame))
+                {
+                    EXPECT_TRUE(UnpackInputFrame(frame, authorityInput));
+                    authorityHasInput = true;
+                    stateDue = true;
+                }
+                if(authorityHasInput)
+                    authorityPosition = StepMove(authorityPosition, authorityInput, deltaTime);
+            };
+
+            for(AZ::u32 tick = 0; tick < ticks; ++tick)
+            {
+                while(!inputsInFlight.empty() && inputsInFlight.front().m_deliveryTick <= tick)
+                {
+                    receivedInputs.Push(inputsInFlight.front().m_frame, 64);
+                    inputsInFlight.pop_front();
+                }
+                while(!statesInFlight.empty() && statesInFlight.front().m_deliveryTick <= tick)
+                {
+                    AZ::Vector3 correctedPosition = AZ::Vector3::CreateZero();
+                    AZ::u32 replayedMoves = 0;
+                    if(predictedMoves.Reconcile(statesInFlight.front().m_frame, 0.f, correctedPosition, replayedMoves))
+                    {
+                        autonomousPosition = correctedPosition;
+                        ++corrections;
+                    }
+                    statesInFlight.pop_front();
+                }
+
+                if(authorityStepsFirst)
+                {
+                    stepAuthority(tick);
+                    stepAutonomous(tick);
+                }
+                else
+                {
+                    stepAutonomous(tick);
+                    stepAuthority(tick);
+                }
+            }
+            return corrections;
+        }
+    } // namespace
+
+    TEST_F(NetworkPredictionTest, QuantizedInput_IsWhatTheAuthorityUnpacks)
+    {
+        ControllerSnapshot input;
+        input.m_forwardValue = 0.3f;
+        input.m_rightValue = 0.71f;
+        input.m_yawValue = -3.7f;
+        input.m_pitchValue = 1.25f;
+        input.m_jumpValue = 1.f;
+        input.m_heading = 2.5f;
+
+        InputFrame frame;
+        PackInputFrame(input, frame);
+        ControllerSnapshot unpacked;
+        ASSERT_TRUE(UnpackInputFrame(frame, unpacked));
+
+        const ControllerSnapshot predicted = QuantizeInput(input);
+        ExpectSnapshotsEqual(predicted, unpacked);
+        EXPECT_NE(predicted.m_forwardValue, input.m_forwardValue);
+        EXPECT_FLOAT_EQ(predicted.m_jumpValue, 1.f);
+
+        // The channels at rest only cost their changed bit
+        InputFrame idleFrame;
+        PackInputFrame(ControllerSnapshot(), idleFrame);
+        EXPECT_EQ(idleFrame.m_data.size(), 2u);
+        EXPECT_LT(idleFrame.GetWireSize(), frame.GetWireSize());
+    }
+
+    TEST_F(NetworkPredictionTest, Reconcile_WithinToleranceAcknowledgesWithoutCorrecting)
+    {
+        PredictedMoveHistory history;
+        InputFrame frame;
+        history.Push(7, ControllerSnapshot(), AZ::Vector3::CreateZero(), 64);
+        ASSERT_TRUE(history.CompleteLastMove(0.f, AZ::Vector3(1.f, 0.f, 0.f), frame));
+        EXPECT_EQ(frame.m_sequence, 7u);
+        EXPECT_FALSE(history.CompleteLastMove(0.f, AZ::Vector3(2.f, 0.f, 0.f), frame));
+
+        StateFrame state;
+        state.m_ackSequence = 7;
+        state.m_position = AZ::Vector3(1.01f, 0.f, 0.f);
+        AZ::Vector3 correctedPosition = AZ::Vector3::CreateZero();
+        AZ::u32 replayedMoves = 0;
+        EXPECT_FALSE(history.Reconcile(state, 0.05f, correctedPosition, replayedMoves));
+        EXPECT_EQ(history.GetCount(), 0u);
+        EXPECT_TRUE(history.IsCaughtUp());
+    }
+
+    TEST_F(NetworkPredictionTest, Reconcile_ReplaysUnacknowledgedMovesOnTheAuthoritativePosition)
+    {
+        PredictedMoveHistory history;
+        InputFrame frame;
+        AZ::Vector3 position = AZ::Vector3::CreateZero();
+        for(AZ::u16 sequence = 65534; sequence != 2; ++sequence)
+        {
+            history.Push(sequence, ControllerSnapshot(), position, 64);
+            position += AZ::Vector3(1.f, 0.f, 0.f);
+            ASSERT_TRUE(history.CompleteLastMove(0.f, position, frame));
+        }
+        // The move of the current tick hasn't been stepped yet
+        history.Push(2, ControllerSnapshot(), position, 64);
+        EXPECT_EQ(history.GetCount(), 5u);
+
+        // The authority acknowledges the first move across the sequence wrap around, 0.5 m off the prediction
+        StateFrame state;
+        state.m_ackSequence = 65534;
+        state.m_position = AZ::Vector3(1.5f, 0.f, 0.f);
+        AZ::Vector3 correctedPosition = AZ::Vector3::CreateZero();
+        AZ::u32 replayedMoves = 0;
+        ASSERT_TRUE(history.Reconcile(state, 0.05f, correctedPosition, replayedMoves));
+        EXPECT_EQ(replayedMoves, 3u);
+        EXPECT_NEAR(correctedPosition.GetX(), 4.5f, 1e-5f);
+        EXPECT_FALSE(history.IsCaughtUp());
+
+        // The later moves were rebased, so the authority agreeing with them isn't corrected again
+        state.m_ackSequence = 1;
+        state.m_position = AZ::Vector3(4.5f, 0.f, 0.f);
+        EXPECT_FALSE(history.Reconcile(state, 0.05f, correctedPosition, replayedMoves));
+        EXPECT_TRUE(history.IsCaughtUp());
+    }
+
+    TEST_F(NetworkPredictionTest, Reconcile_ReplaysTheRecordedDisplacementsRatherThanTheInputs)
+    {
+        // The autonomous side predicts 1 m per move along X, the authority has a wall at 1.5 m the prediction didn't know about
+        constexpr float WallX = 1.5f;
+        PredictedMoveHistory history;
+        InputFrame frame;
+        AZ::Vector3 position = AZ::Vector3::CreateZero();
+        for(AZ::u16 sequence = 0; sequence < 3; ++sequence)
+        {
+            history.Push(sequence, ControllerSnapshot(), position, 64);
+            position += AZ::Vector3(1.f, 0.f, 0.f);
+            ASSERT_TRUE(history.CompleteLastMove(0.f, position, frame));
+        }
+
+        StateFrame state;
+        state.m_ackSequence = 1;
+        state.m_position = AZ::Vector3(WallX, 0.f, 0.f);
+        AZ::Vector3 correctedPosition = AZ::Vector3::CreateZero();
+        AZ::u32 replayedMoves = 0;
+        ASSERT_TRUE(history.Reconcile(state, 0.05f, correctedPosition, replayedMoves));
+
+        // Simulating the last move again from the wall would keep the character at it, replaying its displacement
+        // goes through the wall
+        EXPECT_EQ(replayedMoves, 1u);
+        EXPECT_NEAR(correctedPosition.GetX(), WallX + 1.f, 1e-5f);
+
+        // The authority blocked that move as well, and the prediction converges once it is acknowledged
+        state.m_ackSequence = 2;
+        ASSERT_TRUE(history.Reconcile(state, 0.05f, correctedPosition, replayedMoves));
+        EXPECT_EQ(replayedMoves, 0u);
+        EXPECT_NEAR(correctedPosition.GetX(), WallX, 1e-5f);
+        EXPECT_TRUE(history.IsCaughtUp());
+    }
+
+    TEST_F(NetworkPredictionTest, ReceivedInputQueue_DropsStaleFramesAcrossWrapAround)
+    {
+        ReceivedInputQueue queue;
+        InputFrame frame;
+        frame.m_sequence = 65535;
+        EXPECT_TRUE(queue.Push(frame, 64));
+        frame.m_sequence = 0;
+        EXPECT_TRUE(queue.Push(frame, 64));
+        frame.m_sequence = 65535;
+        EXPECT_FALSE(queue.Push(frame, 64));
+
+        InputFrame popped;
+        ASSERT_TRUE(queue.Pop(popped));
+        EXPECT_EQ(popped.m_sequence, 65535u);
+        ASSERT_TRUE(queue.Pop(popped));
+        EXPECT_EQ(popped.m_sequence, 0u);
+        EXPECT_FALSE(queue.Pop(popped));
+        EXPECT_EQ(queue.GetLastPoppedSequence(), 0u);
+
+        // A frame older than the one already stepped is dropped
+        frame.m_sequence = 65534;
+        EXPECT_FALSE(queue.Push(frame, 64));
+        frame.m_sequence = 1;
+        EXPECT_TRUE(queue.Push(frame, 64));
+    }
+
+    TEST_F(NetworkPredictionTest, Prediction_MatchesTheAuthorityWhicheverSideStepsFirst)
+    {
+        EXPECT_EQ(RunLoopback(240, false, true), 0u);
+        EXPECT_EQ(RunLoopback(240, true, true), 0u);
+
+        // Predicting with the full precision input drifts from the authority and gets corrected
+        EXPECT_GT(RunLoopback(240, false, false), 0u);
+    }
+
+    class InteractableSpatialGridTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(InteractableSpatialGridTest, QueryRadius_ReturnsOnlyEntitiesWithinRadius)
+    {
+        InteractableSpatialGrid grid(2.f);
+        grid.Insert(AZ::EntityId(1), AZ::Vector3(0.5f, 0.f, 0.f));
+        grid.Insert(AZ::EntityId(2), AZ::Vector3(-2.9f, 0.f, 0.f));
+        grid.Insert(AZ::EntityId(3), AZ::Vector3(0.f, 3.1f, 0.f));
+        grid.Insert(AZ::EntityId(4), AZ::Vector3(40.f, 0.f, 0.f));
+        EXPECT_EQ(grid.GetCount(), 4u);
+
+        AZStd::vector<AZ::EntityId> results;
+        grid.QueryRadius(AZ::Vector3::CreateZero(), 3.f, results);
+        AZStd::sort(results.begin(), results.end());
+        ASSERT_EQ(results.size(), 2u);
+        EXPECT_EQ(results[0], AZ::EntityId(1));
+        EXPECT_EQ(results[1], AZ::EntityId(2));
+    }
+
+    TEST_F(InteractableSpatialGridTest, Insert_MovesExistingEntityBetweenCells)
+    {
+        InteractableSpatialGrid grid(1.f);
+        grid.Insert(AZ::EntityId(1), AZ::Vector3::CreateZero());
+        grid.Insert(AZ::EntityId(1), AZ::Vector3(10.f, 10.f, 0.f));
+        EXPECT_EQ(grid.GetCount(), 1u);
+
+        AZStd::vector<AZ::EntityId> results;
+        grid.QueryRadius(AZ::Vector3::CreateZero(), 1.f, results);
+        EXPECT_TRUE(results.empty());
+
+        grid.QueryRadius(AZ::Vector3(10.f, 10.f, 0.f), 0.5f, results);
+        ASSERT_EQ(results.size(), 1u);
+        EXPECT_EQ(results[0], AZ::EntityId(1));
+
+        grid.Remove(AZ::EntityId(1));
+        EXPECT_FALSE(grid.Contains(AZ::EntityId(1)));
+        EXPECT_EQ(grid.GetCount(), 0u);
+    }
+
+    TEST_F(InteractableSpatialGridTest, QueryCone_ReturnsOnlyEntitiesInView)
+    {
+        InteractableSpatialGrid grid;
+        grid.Insert(AZ::EntityId(1), AZ::Vector3(0.f, 2.f, 0.f));
+        grid.Insert(AZ::EntityId(2), AZ::Vector3(1.f, 2.f, 0.f));
+        grid.Insert(AZ::EntityId(3), AZ::Vector3(2.f, 0.5f, 0.f));
+        grid.Insert(AZ::EntityId(4), AZ::Vector3(0.f, -2.f, 0.f));
+        grid.Insert(AZ::EntityId(5), AZ::Vector3(0.f, 5.f, 0.f));
+
+        // 30 degree half angle looking along +Y, 3 m deep
+        AZStd::vector<AZ::EntityId> results;
+        grid.QueryCone(AZ::Vector3::CreateZero(), AZ::Vector3(0.f, 1.f, 0.f), 3.f, AZ::Constants::Pi / 6.f, results);
+        AZStd::sort(results.begin(), results.end());
+        ASSERT_EQ(results.size(), 2u);
+        EXPECT_EQ(results[0], AZ::EntityId(1));
+        EXPECT_EQ(results[1], AZ::EntityId(2));
+
+        // A half angle wider than 90 degrees includes everything but what is directly behind
+        results.clear();
+        grid.QueryCone(AZ::Vector3::CreateZero(), AZ::Vector3(0.f, 1.f, 0.f), 3.f, AZ::Constants::Pi * 0.75f, results);
+        EXPECT_EQ(results.size(), 3u);
+    }
+
+    TEST_F(InteractableSpatialGridTest, QueryRadius_LargeRadiusVisitsOccupiedCells)
+    {
+        InteractableSpatialGrid grid(1.f);
+        grid.Insert(AZ::EntityId(1), AZ::Vector3(-500.f, 0.f, 0.f));
+        grid.Insert(AZ::EntityId(2), AZ::Vector3(500.f, 0.f, 0.f));
+
+        AZStd::vector<AZ::EntityId> results;
+        grid.QueryRadius(AZ::Vector3::CreateZero(), 1000.f, results);
+        EXPECT_EQ(results.size(), 2u);
+    }
+
+    class PlatformVelocityTrackerTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(PlatformVelocityTrackerTest, Elevator_TenMetersPerSecondCarriesCharacter)
+    {
+        constexpr float ElevatorSpeed = 10.f;
+        constexpr float DeltaTime = 1.f / 60.f;
+        const AZ::EntityId elevatorId(1);
+
+        PlatformVelocityTracker tracker;
+        AZ::Vector3 elevatorPosition = AZ::Vector3::CreateZero();
+        AZ::Vector3 characterPosition(0.5f, -0.25f, 0.1f);
+
+        // The first update on a platform has nothing to compare against
+        EXPECT_TRUE(tracker.Update(elevatorId, AZ::Transform::CreateTranslation(elevatorPosition), characterPosition, DeltaTime).IsZero());
+
+        // Ascend for two seconds then descend for two seconds, the character moves with the inherited velocity
+        for(int step = 0; step < 240; ++step)
+        {
+            const float direction = step < 120 ? 1.f : -1.f;
+            elevatorPosition += AZ::Vector3(0.f, 0.f, direction * ElevatorSpeed * DeltaTime);
+
+            const AZ::Vector3 velocity = tracker.Update(elevatorId, AZ::Transform::CreateTranslation(elevatorPosition), characterPosition, DeltaTime);
+            EXPECT_NEAR(velocity.GetX(), 0.f, 1e-3f);
+            EXPECT_NEAR(velocity.GetY(), 0.f, 1e-3f);
+            EXPECT_NEAR(velocity.GetZ(), direction * ElevatorSpeed, 1e-2f);
+
+            characterPosition += velocity * DeltaTime;
+            EXPECT_NEAR(characterPosition.GetZ() - elevatorPosition.GetZ(), 0.1f, 1e-3f);
+        }
+        EXPECT_NEAR(elevatorPosition.GetZ(), 0.f, 1e-3f);
+    }
+
+    TEST_F(PlatformVelocityTrackerTest, ControllerStep_WalkingOnAMovingPlatform)
+    {
+        constexpr float DeltaTime = 1.f / 60.f;
+        const AZ::EntityId platformId(1);
+        const AZ::Vector3 walkVelocity(1.5f, 0.f, 0.f);
+
+        // The platform is moved by setting its transform, then as a rigid body that reports its velocity
+        for(const bool reportsBodyVelocity : { false, true })
+        {
+            PlatformVelocityTracker tracker;
+            AZ::Vector3 platformPosition = AZ::Vector3::CreateZero();
+            AZ::Vector3 characterPosition(0.f, 0.f, 0.5f);
+
+            // The character stands on the platform for a step before it starts moving, the first step on a platform inherits nothing
+            float yawDelta = 0.f;
+            EXPECT_TRUE(tracker.Step(platformId, AZ::Transform::CreateTranslation(platformPosition), PlatformBodyVelocity(),
+                characterPosition, DeltaTime, yawDelta).IsZero());
+
+            // Each step the controller adds the platform's velocity to the walking velocity and the character is moved by their sum,
+            // the platform rises and then moves sideways
+            for(int step = 0; step < 120; ++step)
+            {
+                const AZ::Vector3 platformVelocity = step < 60 ? AZ::Vector3(0.f, 0.f, 3.f) : AZ::Vector3(0.f, -2.f, 0.f);
+                platformPosition += platformVelocity * DeltaTime;
+
+                PlatformBodyVelocity bodyVelocity;
+                if(reportsBodyVelocity)
+                    bodyVelocity.m_linearVelocity = platformVelocity;
+
+                const AZ::Vector3 inherited = tracker.Step(platformId, AZ::Transform::CreateTranslation(platformPosition), bodyVelocity,
+                    characterPosition, DeltaTime, yawDelta);
+                EXPECT_FLOAT_EQ(yawDelta, 0.f);
+                characterPosition += (walkVelocity + inherited) * DeltaTime;
+            }
+
+            // Relative to the platform, the character only moved by walking
+            const AZ::Vector3 offset = characterPosition - platformPosition;
+            EXPECT_NEAR(offset.GetX(), walkVelocity.GetX() * 120.f * DeltaTime, 1e-3f);
+            EXPECT_NEAR(offset.GetY(), 0.f, 1e-3f);
+            EXPECT_NEAR(offset.GetZ(), 0.5f, 1e-3f);
+        }
+    }
+
+    TEST_F(PlatformVelocityTrackerTest, Update_ChangingPlatformRestartsTracking)
+    {
+        PlatformVelocityTracker tracker;
+        tracker.Update(AZ::EntityId(1), AZ::Transform::CreateIdentity(), AZ::Vector3::CreateZero(), 0.1f);
+        const AZ::Vector3 velocity = tracker.Update(AZ::EntityId(2), AZ::Transform::CreateTranslation(AZ::Vector3(0.f, 0.f, 5.f)),
+            AZ::Vector3::CreateZero(), 0.1f);
+        EXPECT_TRUE(velocity.IsZero());
+    }
+
+    TEST_F(PlatformVelocityTrackerTest, RotatingPlatform_CarriesPointAroundAxis)
+    {
+        // A point 2 m from the axis of a platform turning at 1 rad/s moves at 2 m/s tangentially
+        const AZ::Vector3 pointVelocity = PlatformVelocityTracker::GetPointVelocity(AZ::Vector3::CreateZero(),
+            AZ::Vector3(0.f, 0.f, 1.f), AZ::Vector3::CreateZero(), AZ::Vector3(2.f, 0.f, 0.f));
+        EXPECT_NEAR(pointVelocity.GetX(), 0.f, 1e-5f);
+        EXPECT_NEAR(pointVelocity.GetY(), 2.f, 1e-5f);
+        EXPECT_NEAR(pointVelocity.GetZ(), 0.f, 1e-5f);
+
+        constexpr float DeltaTime = 0.01f;
+        PlatformVelocityTracker tracker;
+        tracker.Update(AZ::EntityId(1), AZ::Transform::CreateIdentity(), AZ::Vector3(2.f, 0.f, 0.f), DeltaTime);
+        const AZ::Vector3 trackedVelocity = tracker.Update(AZ::EntityId(1),
+            AZ::Transform(AZ::Vector3::CreateZero(), AZ::Quaternion::CreateRotationZ(DeltaTime), 1.f), AZ::Vector3(2.f, 0.f, 0.f), DeltaTime);
+        EXPECT_NEAR(trackedVelocity.GetY(), 2.f, 1e-2f);
+        EXPECT_NEAR(tracker.GetYawDelta(), DeltaTime, 1e-5f);
+    }
+
+    class KinematicMoverSystemTest : public LeakDetectionFixture
+    {
+    public:
+        static constexpr float DeltaTime = 0.25f;
+
+        struct MoverEvent
+        {
+            AZ::EntityId m_entityId;
+            bool m_arrived = false;
+            float m_position = 0.f;
+        };
+
+        // Records the notifications of one mover in a log shared by the movers. On arrival it can send the mover
+        // back to returnPosition and note the position of another mover at that moment.
+        class MoverEventRecorder : public KinematicMoverNotificationBus::Handler
+        {
+        public:
+            MoverEventRecorder(KinematicMoverSystem& system, const AZ::EntityId& entityId, AZStd::vector<MoverEvent>& log)
+                : m_system(system)
+                , m_entityId(entityId)
+                , m_log(log)
+            {
+                BusConnect(entityId);
+            }
+            ~MoverEventRecorder() override
+            {
+                BusDisconnect();
+            }
+
+            void OnMoverStarted(const float& targetPosition) override
+            {
+                m_log.push_back({ m_entityId, false, targetPosition });
+            }
+            void OnMoverArrived(const float& position) override
+            {
+                m_log.push_back({ m_entityId, true, position });
+                if(m_observedEntityId.IsValid())
+                    m_observedPosition = m_system.GetPosition(m_observedEntityId);
+                if(m_returnPosition >= 0.f)
+                    m_system.GoTo(m_entityId, m_returnPosition);
+            }
+
+            KinematicMoverSystem& m_system;
+            AZ::EntityId m_entityId;
+            AZStd::vector<MoverEvent>& m_log;
+            AZ::EntityId m_observedEntityId;
+            float m_observedPosition = -1.f;
+            float m_returnPosition = -1.f;
+        };
+
+        // The movers have no rigid body, the system still steps them and sends their notifications
+        static void AddMover(KinematicMoverSystem& system, const AZ::EntityId& entityId, const float& travelTime, const float& position)
+        {
+            system.AddMover(entityId, AZ::Transform::CreateIdentity(), AZ::Transform::CreateTranslation(AZ::Vector3(0.f, 0.f, 4.f)),
+                travelTime, KinematicMoverEasing::Linear, position);
+        }
+    };
+
+    TEST_F(KinematicMoverSystemTest, GoTo_StepsToTheTargetThenArrivesAndSettles)
+    {
+        KinematicMoverSystem system;
+        const AZ::EntityId elevatorId(1);
+        AddMover(system, elevatorId, 1.f, 0.f);
+
+        AZStd::vector<MoverEvent> log;
+        MoverEventRecorder recorder(system, elevatorId, log);
+
+        system.GoTo(elevatorId, 1.f);
+        EXPECT_TRUE(system.GetIsMoving(elevatorId));
+        EXPECT_EQ(system.GetActiveMoverCount(), 1u);
+        ASSERT_EQ(log.size(), 1u);
+        EXPECT_FALSE(log[0].m_arrived);
+        EXPECT_FLOAT_EQ(log[0].m_position, 1.f);
+
+        for(int step = 1; step < 4; ++step)
+        {
+            system.Step(DeltaTime);
+            EXPECT_FLOAT_EQ(system.GetPosition(elevatorId), step * DeltaTime);
+        }
+        EXPECT_EQ(log.size(), 1u);
+
+        // The final target is written on the arrival step and the body is only put to sleep on the following step
+        system.Step(DeltaTime);
+        EXPECT_FLOAT_EQ(system.GetPosition(elevatorId), 1.f);
+        EXPECT_FALSE(system.GetIsMoving(elevatorId));
+        EXPECT_EQ(system.GetActiveMoverCount(), 0u);
+        EXPECT_EQ(system.GetSettlingMoverCount(), 1u);
+        ASSERT_EQ(log.size(), 2u);
+        EXPECT_TRUE(log[1].m_arrived);
+        EXPECT_FLOAT_EQ(log[1].m_position, 1.f);
+
+        system.Step(DeltaTime);
+        EXPECT_EQ(system.GetSettlingMoverCount(), 0u);
+        EXPECT_EQ(log.size(), 2u);
+
+        // Going to the current position doesn't start the mover
+        system.GoTo(elevatorId, 1.f);
+        EXPECT_FALSE(system.GetIsMoving(elevatorId));
+        EXPECT_EQ(log.size(), 2u);
+    }
+
+    TEST_F(KinematicMoverSystemTest, Stop_ArrivesAtTheCurrentPositionOnTheNextStep)
+    {
+        KinematicMoverSystem system;
+        const AZ::EntityId doorId(1);
+        AddMover(system, doorId, 1.f, 0.f);
+
+        AZStd::vector<MoverEvent> log;
+        MoverEventRecorder recorder(system, doorId, log);
+
+        system.GoTo(doorId, 1.f);
+        system.Step(DeltaTime);
+        system.Step(DeltaTime);
+        system.Stop(doorId);
+        EXPECT_FLOAT_EQ(system.GetTargetPosition(doorId), 0.5f);
+        EXPECT_TRUE(system.GetIsMoving(doorId));
+
+        system.Step(DeltaTime);
+        EXPECT_FLOAT_EQ(system.GetPosition(doorId), 0.5f);
+        EXPECT_FALSE(system.GetIsMoving(doorId));
+        ASSERT_EQ(log.size(), 2u);
+        EXPECT_TRUE(log[1].m_arrived);
+        EXPECT_FLOAT_EQ(log[1].m_position, 0.5f);
+
+        // A stopped mover resumes from where it stopped
+        system.GoTo(doorId, 0.f);
+        system.Step(DeltaTime);
+        EXPECT_FLOAT_EQ(system.GetPosition(doorId), 0.25f);
+    }
+
+    TEST_F(KinematicMoverSystemTest, Interface_ReachesTheFirstSystemUntilItIsDestroyed)
+    {
+        ASSERT_EQ(KinematicMoverSystemInterface::Get(), nullptr);
+        {
+            KinematicMoverSystem system;
+            KinematicMoverSystem otherSystem;
+            KinematicMoverSystemRequests* moverSystem = KinematicMoverSystemInterface::Get();
+            ASSERT_EQ(moverSystem, &system);
+
+            const AZ::EntityId gateId(1);
+            moverSystem->AddMover(gateId, AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity(), 1.f,
+                KinematicMoverEasing::Linear, 0.f);
+            moverSystem->GoTo(gateId, 1.f);
+            EXPECT_EQ(system.GetActiveMoverCount(), 1u);
+            EXPECT_EQ(otherSystem.GetMoverCount(), 0u);
+        }
+        EXPECT_EQ(KinematicMoverSystemInterface::Get(), nullptr);
+    }
+
+    TEST_F(KinematicMoverSystemTest, Arrivals_AreSentInStartOrderOnceEveryMoverIsStepped)
+    {
+        KinematicMoverSystem system;
+        const AZ::EntityId liftId(1);
+        const AZ::EntityId platformId(2);
+        // Both arrive after two steps
+        AddMover(system, liftId, 1.f, 0.5f);
+        AddMover(system, platformId, 0.5f, 0.f);
+
+        AZStd::vector<MoverEvent> log;
+        MoverEventRecorder liftRecorder(system, liftId, log);
+        MoverEventRecorder platformRecorder(system, platformId, log);
+        // The platform is sent back on arrival, and the lift notes where the platform is when it arrives
+        platformRecorder.m_returnPosition = 0.f;
+        liftRecorder.m_observedEntityId = platformId;
+
+        system.GoTo(platformId, 1.f);
+        system.GoTo(liftId, 1.f);
+        system.Step(DeltaTime);
+        system.Step(DeltaTime);
+
+        ASSERT_EQ(log.size(), 5u);
+        EXPECT_EQ(log[0].m_entityId, platformId);
+        EXPECT_EQ(log[1].m_entityId, liftId);
+        EXPECT_TRUE(log[2].m_arrived);
+        EXPECT_EQ(log[2].m_entityId, platformId);
+        // The platform's return starts from its arrival handler, ahead of the lift's arrival
+        EXPECT_FALSE(log[3].m_arrived);
+        EXPECT_EQ(log[3].m_entityId, platformId);
+        EXPECT_FLOAT_EQ(log[3].m_position, 0.f);
+        EXPECT_TRUE(log[4].m_arrived);
+        EXPECT_EQ(log[4].m_entityId, liftId);
+
+        // Arrivals are only sent after the step, so the platform had already reached the end when the lift arrived
+        EXPECT_FLOAT_EQ(liftRecorder.m_observedPosition, 1.f);
+
+        // The platform started moving again before it was settled, so only the lift is put to sleep
+        EXPECT_EQ(system.GetSettlingMoverCount(), 1u);
+        EXPECT_TRUE(system.GetIsMoving(platformId));
+        system.Step(DeltaTime);
+        EXPECT_EQ(system.GetSettlingMoverCount(), 0u);
+        EXPECT_FLOAT_EQ(system.GetPosition(platformId), 0.5f);
+    }
+
+    class ControllerStepSchedulerTest : public LeakDetectionFixture
+    {
+    public:
+        static constexpr float DeltaTime = 1.f / 60.f;
+        static constexpr int ProbeCount = 8;
+
+        // Stands in for a controller. PlanSceneQueries probes the obstacles around it as the ground, head and stand sweeps
+        // probe the physics scene, and FinishStep steers away from what the probes found.
+        class ProbingController : public SteppedController
+        {
+        public:
+            ProbingController(const InteractableSpatialGrid& obstacles, const AZ::Vector3& position, const float& heading,
+                AZStd::vector<AZ::Vector3>& endLog)
+                : m_obstacles(obstacles)
+                , m_position(position)
+                , m_heading(heading)
+                , m_endLog(endLog)
+            {
+                m_hits.reserve(32);
+            }
+
+            float GetPhysicsTimestepScaleFactor() const override
+            {
+                return 1.f;
+            }
+            bool BeginStep([[maybe_unused]] float& stepDeltaTime, const bool& timestepElseTick) override
+            {
+                return !timestepElseTick;
+            }
+            void PlanSceneQueries() override
+            {
+                m_planThreadId = AZStd::this_thread::get_id();
+                m_avoidance = AZ::Vector3::CreateZero();
+                for(int probe = 0; probe < ProbeCount; ++probe)
+                {
+                    const float angle = m_heading + static_cast<float>(probe) * AZ::Constants::TwoPi / static_cast<float>(ProbeCount);
+                    const AZ::Vector3 offset(AZStd::cos(angle) * 2.f, AZStd::sin(angle) * 2.f, 0.f);
+
+                    m_hits.clear();
+                    m_obstacles.QueryRadius(m_position + offset, 1.5f, m_hits);
+                    m_avoidance -= offset * static_cast<float>(m_hits.size());
+                }
+            }
+            void FinishStep(const float& stepDeltaTime) override
+            {
+                const AZ::Vector3 forward(AZStd::cos(m_heading) * 4.f, AZStd::sin(m_heading) * 4.f, 0.f);
+                m_position += (forward + m_avoidance * 0.1f) * stepDeltaTime;
+                m_heading += 0.05f;
+            }
+            void EndStep() override
+            {
+                m_endLog.push_back(m_position);
+                ++m_endStepCount;
+                // Stands in for a notification handler that calls back into the controllers
+                if(m_onEndStep)
+                    m_onEndStep();
+            }
+
+            const InteractableSpatialGrid& m_obstacles;
+            AZ::Vector3 m_position;
+            float m_heading = 0.f;
+            AZ::Vector3 m_avoidance = AZ::Vector3::CreateZero();
+            AZStd::vector<AZ::EntityId> m_hits;
+            AZStd::vector<AZ::Vector3>& m_endLog;
+            AZStd::thread_id m_planThreadId;
+            int m_endStepCount = 0;
+            AZStd::function<void()> m_onEndStep;
+        };
+
+        // Job manager with the given number of workers, used as the global job context while it exists
+        class ScopedJobContext
+        {
+        public:
+            explicit ScopedJobContext(const AZ::u32& workerCount)
+            {
+                AZ::JobManagerDesc jobManagerDesc;
+                for(AZ::u32 i = 0; i < workerCount; ++i)
+                    jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+                m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+                m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+                m_previousJobContext = AZ::JobContext::GetGlobalContext();
+                AZ::JobContext::SetGlobalContext(m_jobContext.get());
+            }
+            ~ScopedJobContext()
+            {
+                AZ::JobContext::SetGlobalContext(m_previousJobContext);
+            }
+
+        private:
+            AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+            AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+            AZ::JobContext* m_previousJobContext = nullptr;
+        };
+
+        // Obstacles spread across a square of the given half extent around the origin
+        static void CreateObstacles(InteractableSpatialGrid& obstacles, const AZ::u32& count, const float& halfExtent)
+        {
+            AZ::u32 seed = 12345;
+            for(AZ::u32 i = 0; i < count; ++i)
+            {
+                seed = seed * 1664525u + 1013904223u;
+                const float x = (static_cast<float>(seed % 10000) / 5000.f - 1.f) * halfExtent;
+                seed = seed * 1664525u + 1013904223u;
+                const float y = (static_cast<float>(seed % 10000) / 5000.f - 1.f) * halfExtent;
+                obstacles.Insert(AZ::EntityId(i + 1), AZ::Vector3(x, y, 0.f));
+            }
+        }
+
+        // Controllers spread over a ring inside the obstacles, heading along it
+        static void CreateControllers(AZStd::vector<AZStd::unique_ptr<ProbingController>>& controllers, const AZ::u32& count,
+            const InteractableSpatialGrid& obstacles, AZStd::vector<AZ::Vector3>& endLog)
+        {
+            for(AZ::u32 i = 0; i < count; ++i)
+            {
+                const float angle = static_cast<float>(i) * AZ::Constants::TwoPi / static_cast<float>(count);
+                controllers.push_back(AZStd::make_unique<ProbingController>(obstacles,
+                    AZ::Vector3(AZStd::cos(angle) * 20.f, AZStd::sin(angle) * 20.f, 0.f), angle, endLog));
+            }
+        }
+
+        static AzPhysics::SceneHandle GetSceneHandle(const AZ::u32& index)
+        {
+            return AzPhysics::SceneHandle(AZ::Crc32(index % 2 == 0 ? "SceneA" : "SceneB"), static_cast<AZ::s8>(index % 2));
+        }
+    };
+
+    TEST_F(ControllerStepSchedulerTest, ParallelQueries_StepTheSameAsSerial)
+    {
+        constexpr AZ::u32 ControllerCount = 64;
+        constexpr int TickCount = 30;
+
+        InteractableSpatialGrid obstacles;
+        CreateObstacles(obstacles, 2000, 40.f);
+
+        AZStd::vector<AZ::Vector3> serialLog;
+        {
+            AZStd::vector<AZStd::unique_ptr<ProbingController>> controllers;
+            CreateControllers(controllers, ControllerCount, obstacles, serialLog);
+
+            ControllerStepScheduler scheduler;
+            for(AZ::u32 i = 0; i < ControllerCount; ++i)
+                scheduler.AddController(controllers[i].get(), GetSceneHandle(i), false);
+            for(int tick = 0; tick < TickCount; ++tick)
+                scheduler.Tick(DeltaTime);
+            scheduler.Clear();
+        }
+
+        AZStd::vector<AZ::Vector3> parallelLog;
+        bool plannedOnWorker = false;
+        {
+            ScopedJobContext jobContext(4);
+            AZStd::vector<AZStd::unique_ptr<ProbingController>> controllers;
+            CreateControllers(controllers, ControllerCount, obstacles, parallelLog);
+
+            // An uneven job size leaves a partly filled job in each scene
+            ControllerStepScheduler scheduler;
+            scheduler.SetParallelSceneStepping(true);
+            scheduler.SetControllersPerJob(5);
+            for(AZ::u32 i = 0; i < ControllerCount; ++i)
+                scheduler.AddController(controllers[i].get(), GetSceneHandle(i), false);
+            EXPECT_EQ(scheduler.GetSceneCount(), 2);
+
+            for(int tick = 0; tick < TickCount; ++tick)
+                scheduler.Tick(DeltaTime);
+            scheduler.Clear();
+
+            for(const auto& controller : controllers)
+                plannedOnWorker |= controller->m_planThreadId != AZStd::this_thread::get_id();
+        }
+        EXPECT_TRUE(plannedOnWorker);
+
+        // The steps end in the same order with bit identical positions
+        ASSERT_EQ(parallelLog.size(), ControllerCount * TickCount);
+        ASSERT_EQ(parallelLog.size(), serialLog.size());
+        for(size_t i = 0; i < serialLog.size(); ++i)
+        {
+            EXPECT_EQ(parallelLog[i].GetX(), serialLog[i].GetX()) << "step end " << i;
+            EXPECT_EQ(parallelLog[i].GetY(), serialLog[i].GetY()) << "step end " << i;
+        }
+    }
+
+    TEST_F(ControllerStepSchedulerTest, AddController_DuringAStepMovesTheControllerOnceItsStepEnds)
+    {
+        InteractableSpatialGrid obstacles;
+        AZStd::vector<AZ::Vector3> endLog;
+        AZStd::vector<AZStd::unique_ptr<ProbingController>> controllers;
+        CreateControllers(controllers, 3, obstacles, endLog);
+
+        ControllerStepScheduler scheduler;
+        for(const auto& controller : controllers)
+            scheduler.AddController(controller.get(), GetSceneHandle(0), false);
+
+        // The first controller's handler moves a controller whose step hasn't ended yet and then itself,
+        // as SetQuerySceneName and SetAddVelocityForTimestepVsTick do through AttachStepping
+        ProbingController* first = controllers[0].get();
+        ProbingController* last = controllers[2].get();
+        first->m_onEndStep = [&]()
+        {
+            scheduler.AddController(last, GetSceneHandle(1), false);
+            scheduler.AddController(first, GetSceneHandle(1), false);
+        };
+
+        scheduler.Tick(DeltaTime);
+        for(const auto& controller : controllers)
+            EXPECT_EQ(controller->m_endStepCount, 1);
+        EXPECT_EQ(scheduler.GetSceneCount(), 2);
+        EXPECT_EQ(scheduler.GetControllerCount(), 3);
+
+        // Once moved, both keep stepping in their new scene
+        first->m_onEndStep = nullptr;
+        scheduler.Tick(DeltaTime);
+        for(const auto& controller : controllers)
+            EXPECT_EQ(controller->m_endStepCount, 2);
+
+        // A controller removed during a step, as on deactivation, is skipped for the rest of it and a move held back
+        // for it is dropped. The scenes end their steps in turn, so the middle controller ends before the last.
+        controllers[1]->m_onEndStep = [&]()
+        {
+            scheduler.AddController(last, GetSceneHandle(0), false);
+            scheduler.RemoveController(last);
+        };
+        scheduler.Tick(DeltaTime);
+        EXPECT_EQ(first->m_endStepCount, 3);
+        EXPECT_EQ(last->m_endStepCount, 2);
+        EXPECT_EQ(scheduler.GetControllerCount(), 2);
+        scheduler.Clear();
+    }
+
+    class ControllerLodTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(ControllerLodTest, SelectTier_UsesTheDistanceBands)
+    {
+        constexpr float ReducedDistance = 20.f;
+        constexpr float MinimalDistance = 50.f;
+
+        EXPECT_EQ(ControllerLod::SelectTier(0.f, ReducedDistance, MinimalDistance), LodTier::Full);
+        EXPECT_EQ(ControllerLod::SelectTier(19.9f*19.9f, ReducedDistance, MinimalDistance), LodTier::Full);
+        EXPECT_EQ(ControllerLod::SelectTier(20.f*20.f, ReducedDistance, MinimalDistance), LodTier::Reduced);
+        EXPECT_EQ(ControllerLod::SelectTier(49.9f*49.9f, ReducedDistance, MinimalDistance), LodTier::Reduced);
+        EXPECT_EQ(ControllerLod::SelectTier(50.f*50.f, ReducedDistance, MinimalDistance), LodTier::Minimal);
+
+        // A minimal distance inside the reduced distance skips the reduced tier
+        EXPECT_EQ(ControllerLod::SelectTier(30.f*30.f, ReducedDistance, 25.f), LodTier::Minimal);
+    }
+
+    TEST_F(ControllerLodTest, StepDue_StepsWithTheTimeOfTheSkippedSteps)
+    {
+        constexpr float DeltaTime = 1.f / 60.f;
+        const AZ::u32 stepInterval = ControllerLod::GetStepInterval(LodTier::Reduced, 3, 6);
+        ASSERT_EQ(stepInterval, 3u);
+        EXPECT_EQ(ControllerLod::GetStepInterval(LodTier::Full, 3, 6), 1u);
+        EXPECT_EQ(ControllerLod::GetStepInterval(LodTier::Minimal, 3, 6), 6u);
+
+        AZ::u32 skippedSteps = 0;
+        float accumulatedDeltaTime = 0.f;
+        for(int cycle = 0; cycle < 2; ++cycle)
+        {
+            for(AZ::u32 i = 1; i < stepInterval; ++i)
+            {
+                float stepDeltaTime = DeltaTime;
+                EXPECT_FALSE(ControllerLod::StepDue(skippedSteps, accumulatedDeltaTime, stepDeltaTime, stepInterval));
+            }
+            float stepDeltaTime = DeltaTime;
+            EXPECT_TRUE(ControllerLod::StepDue(skippedSteps, accumulatedDeltaTime, stepDeltaTime, stepInterval));
+            EXPECT_FLOAT_EQ(stepDeltaTime, DeltaTime * stepInterval);
+            EXPECT_EQ(skippedSteps, 0u);
+        }
+
+        // Returning to the full tier steps every time with the step's own delta time
+        float stepDeltaTime = DeltaTime;
+        EXPECT_TRUE(ControllerLod::StepDue(skippedSteps, accumulatedDeltaTime, stepDeltaTime, 1));
+        EXPECT_FLOAT_EQ(stepDeltaTime, DeltaTime);
+    }
+
+    class DeferredEventQueueTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(DeferredEventQueueTest, Flush_DispatchesTheEventsRaisedDuringTheDeferralInOrder)
+    {
+        DeferredEventQueue<int> queue;
+        AZStd::vector<int> dispatched;
+        auto dispatch = [&dispatched](const int& event)
+            {
+                dispatched.push_back(event);
+            };
+
+        // Outside of a deferral, e.g. a ladder entered between steps, events go out right away
+        queue.Push(1, dispatch);
+        ASSERT_EQ(dispatched.size(), 1u);
+
+        queue.Defer();
+        queue.Push(2, dispatch);
+        queue.Push(3, dispatch);
+        queue.Push(2, dispatch);
+        EXPECT_EQ(dispatched.size(), 1u);
+        EXPECT_EQ(queue.GetCount(), 3u);
+
+        queue.Flush(dispatch);
+        EXPECT_FALSE(queue.IsDeferring());
+        EXPECT_EQ(queue.GetCount(), 0u);
+        ASSERT_EQ(dispatched.size(), 4u);
+        EXPECT_EQ(dispatched[1], 2);
+        EXPECT_EQ(dispatched[2], 3);
+        EXPECT_EQ(dispatched[3], 2);
+
+        // Clearing, as on deactivation, drops the queued events
+        queue.Defer();
+        queue.Push(4, dispatch);
+        queue.Clear();
+        queue.Flush(dispatch);
+        EXPECT_EQ(dispatched.size(), 4u);
+    }
+
+    TEST_F(DeferredEventQueueTest, Flush_DispatchesTheEventsRaisedByHandlersRightAway)
+    {
+        DeferredEventQueue<int> queue;
+        AZStd::vector<int> dispatched;
+        AZStd::function<void(const int&)> dispatch;
+        dispatch = [&](const int& event)
+            {
+                dispatched.push_back(event);
+                // A handler reacting to the first event raises another one and flushes again
+                if(event == 1)
+                {
+                    queue.Push(10, dispatch);
+                    queue.Flush(dispatch);
+                }
+            };
+
+        queue.Defer();
+        queue.Push(1, dispatch);
+        queue.Push(2, dispatch);
+        queue.Flush(dispatch);
+
+        ASSERT_EQ(dispatched.size(), 3u);
+        EXPECT_EQ(dispatched[0], 1);
+        EXPECT_EQ(dispatched[1], 10);
+        EXPECT_EQ(dispatched[2], 2);
+        EXPECT_EQ(queue.GetCount(), 0u);
+    }
+
+    class ImpulsePadResponseTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(ImpulsePadResponseTest, Reflect_RestitutionScalesNormalComponent)
+    {
+        const AZ::Vector3 normal(0.f, 0.f, 1.f);
+        const AZ::Vector3 reflected = ImpulsePadResponse::Reflect(AZ::Vector3(2.f, 0.f, -6.f), normal, 0.5f);
+        EXPECT_NEAR(reflected.GetX(), 2.f, 1e-5f);
+        EXPECT_NEAR(reflected.GetZ(), 3.f, 1e-5f);
+
+        // Velocity already leaving the pad is unchanged
+        const AZ::Vector3 leaving = ImpulsePadResponse::Reflect(AZ::Vector3(0.f, 1.f, 2.f), normal, 1.f);
+        EXPECT_NEAR(leaving.GetY(), 1.f, 1e-5f);
+        EXPECT_NEAR(leaving.GetZ(), 2.f, 1e-5f);
+    }
+
+    TEST_F(ImpulsePadResponseTest, GetBounceVelocity_HighFallWithRestitutionExceedsApexAndIsLimited)
+    {
+        const AZ::Vector3 normal(0.f, 0.f, 1.f);
+        const float launchSpeed = ImpulsePadResponse::GetLaunchSpeed(2.f, -9.8f);
+
+        const AZ::Vector3 gentle = ImpulsePadResponse::GetBounceVelocity(AZ::Vector3(0.f, 0.f, -1.f), normal, 1.f, 2.f, -9.8f, 0.f);
+        EXPECT_NEAR(gentle.GetZ(), launchSpeed, 1e-4f);
+
+        const AZ::Vector3 hard = ImpulsePadResponse::GetBounceVelocity(AZ::Vector3(0.f, 0.f, -20.f), normal, 1.f, 2.f, -9.8f, 0.f);
+        EXPECT_NEAR(hard.GetZ(), 20.f, 1e-4f);
+
+        const AZ::Vector3 limited = ImpulsePadResponse::GetBounceVelocity(AZ::Vector3(0.f, 0.f, -20.f), normal, 1.f, 2.f, -9.8f, 15.f);
+        EXPECT_NEAR(limited.GetLength(), 15.f, 1e-4f);
+    }
+
+    TEST_F(ImpulsePadResponseTest, Launch_ApexHeightIsFrameRateIndependent)
+    {
+        constexpr float Gravity = -9.8f;
+        constexpr float ApexHeight = 3.f;
+        const float launchSpeed = ImpulsePadResponse::GetBounceVelocity(AZ::Vector3(0.f, 0.f, -5.f), AZ::Vector3(0.f, 0.f, 1.f),
+            0.f, ApexHeight, Gravity, 0.f).GetZ();
+
+        for(const float tickRate : { 20.f, 30.f, 60.f, 144.f, 240.f })
+        {
+            // Steps the vertical velocity through the same calls as FirstPersonControllerComponent::UpdateVelocityZ() after a launch,
+            // starting from a character falling onto the pad. The character controller then moves the character by the velocity
+            // over each step, and the falling gravity factor only applies after the apex.
+            const float deltaTime = 1.f / tickRate;
+            float velocityZ = -5.f;
+            float prevDelta = Gravity * deltaTime;
+            VerticalVelocity::Launch(velocityZ, prevDelta, launchSpeed);
+            float height = 0.f;
+            float apex = 0.f;
+            do
+            {
+                const float currentDelta = VerticalVelocity::GetAirborneDelta(velocityZ, Gravity, 2.f, deltaTime);
+                VerticalVelocity::Integrate(velocityZ, prevDelta, currentDelta);
+                height += velocityZ * deltaTime;
+                apex = AZ::GetMax(apex, height);
+            } while(velocityZ > 0.f);
+
+            // The remaining error is bounded by |g|dt^2/8 from the apex falling between two steps
+            EXPECT_NEAR(apex, ApexHeight, -Gravity * deltaTime * deltaTime / 8.f + 1e-3f) << "tick rate " << tickRate;
+        }
+    }
+
+    class InputOverrideStackTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(InputOverrideStackTest, Apply_HighestPriorityWinsPerChannel)
+    {
+        InputOverrideStack stack;
+
+        // Freezes movement and look, as when inspecting a note
+        InputOverride freeze;
+        freeze.m_priority = 0;
+        freeze.m_mask = InputOverrideAllChannels & ~static_cast<AZ::u32>(InputOverrideChannel::Sprint);
+        stack.Push(freeze);
+
+        InputOverride look;
+        look.m_priority = 1;
+        look.m_mask = static_cast<AZ::u32>(InputOverrideChannel::Yaw);
+        look.m_yawValue = 0.5f;
+        stack.Push(look);
+
+        InputChannelValues values = { 1.f, 0.f, 0.f, 1.f, 3.f, -2.f, 1.f, 0.f, 1.f };
+        const AZ::u32 appliedMask = stack.Apply(values);
+
+        EXPECT_EQ(appliedMask, freeze.m_mask);
+        EXPECT_FLOAT_EQ(values[0], 0.f);
+        EXPECT_FLOAT_EQ(values[3], 0.f);
+        EXPECT_FLOAT_EQ(values[4], 0.5f);
+        EXPECT_FLOAT_EQ(values[5], 0.f);
+        EXPECT_FLOAT_EQ(values[6], 1.f);
+        EXPECT_FLOAT_EQ(values[8], 0.f);
+    }
+
+    TEST_F(InputOverrideStackTest, Apply_LowerPriorityPushedLaterDoesNotWin)
+    {
+        InputOverrideStack stack;
+
+        InputOverride high;
+        high.m_priority = 5;
+        high.m_mask = static_cast<AZ::u32>(InputOverrideChannel::Forward);
+        high.m_forwardValue = 1.f;
+        stack.Push(high);
+
+        InputOverride low;
+        low.m_priority = 2;
+        low.m_mask = static_cast<AZ::u32>(InputOverrideChannel::Forward);
+        low.m_forwardValue = -1.f;
+        stack.Push(low);
+
+        InputOverride equal;
+        equal.m_priority = 5;
+        equal.m_mask = static_cast<AZ::u32>(InputOverrideChannel::Forward);
+        equal.m_forwardValue = 0.25f;
+        const AZ::u32 equalHandle = stack.Push(equal);
+
+        InputChannelValues values = {};
+        stack.Apply(values);
+        EXPECT_FLOAT_EQ(values[0], 0.25f);
+
+        EXPECT_TRUE(stack.Pop(equalHandle));
+        EXPECT_FALSE(stack.Pop(equalHandle));
+        stack.Apply(values);
+        EXPECT_FLOAT_EQ(values[0], 1.f);
+        EXPECT_EQ(stack.GetCount(), 2u);
+    }
+
+    TEST_F(InputOverrideStackTest, Tick_ExpiresOverridesAfterTheirTicks)
+    {
+        InputOverrideStack stack;
+
+        InputOverride twoTicks;
+        twoTicks.m_ticks = 2;
+        stack.Push(twoTicks);
+
+        InputOverride untilPopped;
+        untilPopped.m_ticks = 0;
+        const AZ::u32 untilPoppedHandle = stack.Push(untilPopped);
+        EXPECT_NE(untilPoppedHandle, 0u);
+
+        stack.Tick();
+        EXPECT_EQ(stack.GetCount(), 2u);
+        stack.Tick();
+        EXPECT_EQ(stack.GetCount(), 1u);
+        for(int i = 0; i < 100; ++i)
+            stack.Tick();
+        EXPECT_EQ(stack.GetCount(), 1u);
+
+        EXPECT_TRUE(stack.Pop(untilPoppedHandle));
+        EXPECT_TRUE(stack.IsEmpty());
+    }
+
+    TEST_F(InputOverrideStackTest, Restore_KeepsTheChannelsWrittenSinceTheOverridesWereApplied)
+    {
+        InputOverrideStack stack;
+
+        InputOverride freezeMove;
+        freezeMove.m_mask = static_cast<AZ::u32>(InputOverrideChannel::Forward) | static_cast<AZ::u32>(InputOverrideChannel::Right)
+            | static_cast<AZ::u32>(InputOverrideChannel::Jump);
+        stack.Push(freezeMove);
+
+        const InputChannelValues rawValues = { 1.f, 0.f, 0.f, 1.f, 0.5f, 0.f, 0.f, 0.f, 1.f };
+        InputChannelValues values = rawValues;
+        const AZ::u32 appliedMask = stack.Apply(values);
+        const InputChannelValues appliedValues = values;
+
+        // During the step input events change the overridden forward value and the yaw value, which isn't overridden
+        values[0] = 0.5f;
+        values[4] = 0.25f;
+
+        InputOverrideStack::Restore(values, rawValues, appliedValues, appliedMask);
+        EXPECT_FLOAT_EQ(values[0], 0.5f);
+        EXPECT_FLOAT_EQ(values[3], 1.f);
+        EXPECT_FLOAT_EQ(values[4], 0.25f);
+        EXPECT_FLOAT_EQ(values[8], 1.f);
+    }
+
+    class InteractHoldTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(InteractHoldTest, Press_WithoutHoldTimeInteractsRightAway)
+    {
+        InteractHold hold;
+        EXPECT_TRUE(hold.Press(0.f));
+        EXPECT_FALSE(hold.IsHeld());
+        EXPECT_FALSE(hold.Update(1.f, 0.f));
+        EXPECT_FLOAT_EQ(hold.GetProgress(), 0.f);
+    }
+
+    TEST_F(InteractHoldTest, Update_CompletesOnceAndNeedsANewPress)
+    {
+        constexpr float HoldTime = 1.f;
+        InteractHold hold;
+        EXPECT_FALSE(hold.Press(HoldTime));
+        EXPECT_TRUE(hold.IsHeld());
+
+        EXPECT_FALSE(hold.Update(0.5f, HoldTime));
+        EXPECT_FLOAT_EQ(hold.GetProgress(), 0.5f);
+        EXPECT_TRUE(hold.Update(0.75f, HoldTime));
+        EXPECT_FLOAT_EQ(hold.GetProgress(), 1.f);
+        EXPECT_FALSE(hold.IsHeld());
+
+        // Keeping the key down after completing doesn't interact again
+        EXPECT_FALSE(hold.Update(2.f, HoldTime));
+
+        EXPECT_FALSE(hold.Press(HoldTime));
+        EXPECT_FLOAT_EQ(hold.GetProgress(), 0.f);
+        EXPECT_FALSE(hold.Update(0.25f, HoldTime));
+        EXPECT_FLOAT_EQ(hold.GetProgress(), 0.25f);
+    }
+
+    TEST_F(InteractHoldTest, Release_ResetsTheProgressUntilTheNextPress)
+    {
+        constexpr float HoldTime = 2.f;
+        InteractHold hold;
+        hold.Press(HoldTime);
+        hold.Update(1.5f, HoldTime);
+        EXPECT_FLOAT_EQ(hold.GetProgress(), 0.75f);
+
+        // Changing focus releases too, so a key that is still down makes no progress until it is pressed again
+        hold.Release();
+        EXPECT_FLOAT_EQ(hold.GetProgress(), 0.f);
+        EXPECT_FALSE(hold.Update(2.f, HoldTime));
+        EXPECT_FLOAT_EQ(hold.GetProgress(), 0.f);
+    }
+
+    class GamepadInputTest : public LeakDetectionFixture
+    {
+    public:
+        // Stick samples recorded at 60 Hz
+        static constexpr float TraceDeltaTime = 1.f / 60.f;
+
+        // Replays a trace through UpdateLook with each sample held for substeps ticks, returns the accumulated rotation
+        static AZ::Vector2 ReplayLook(const GamepadInputSettings& settings, const AZStd::vector<AZ::Vector2>& trace, const int& substeps)
+        {
+            GamepadInputProcessor processor;
+            AZ::Vector2 rotation = AZ::Vector2::CreateZero();
+            for(const AZ::Vector2& sample : trace)
+                for(int i = 0; i < substeps; ++i)
+                {
+                    const AZ::Vector2 delta = processor.UpdateLook(settings, sample, TraceDeltaTime / static_cast<float>(substeps));
+                    rotation = AZ::Vector2(rotation.GetX() + delta.GetX(), rotation.GetY() + delta.GetY());
+                }
+            return rotation;
+        }
+    };
+
+    TEST_F(GamepadInputTest, RestingStickDriftIsInsideTheDeadZone)
+    {
+        // A worn stick at rest, wandering up to 0.12 from the center
+        const AZStd::vector<AZ::Vector2> trace = {
+            { 0.03f, -0.02f }, { 0.05f, -0.04f }, { 0.08f, -0.06f }, { 0.09f, -0.08f }, { 0.07f, -0.05f },
+            { 0.02f, 0.01f }, { -0.04f, 0.06f }, { -0.08f, 0.09f }, { -0.06f, 0.07f }, { -0.01f, 0.02f } };
+
+        const GamepadInputSettings settings;
+        GamepadInputProcessor processor;
+        for(const AZ::Vector2& sample : trace)
+        {
+            EXPECT_TRUE(processor.GetMoveInput(settings, sample).IsZero());
+            EXPECT_TRUE(processor.UpdateLook(settings, sample, TraceDeltaTime).IsZero());
+        }
+    }
+
+    TEST_F(GamepadInputTest, RadialDeadZoneKeepsDirectionAndSaturatesDiagonals)
+    {
+        const AZ::Vector2 diagonal = GamepadInputProcessor::ApplyRadialDeadZone(AZ::Vector2(0.8f, 0.8f), 0.15f, 0.95f);
+        EXPECT_NEAR(diagonal.GetLength(), 1.f, 1e-5f);
+        EXPECT_NEAR(diagonal.GetX(), diagonal.GetY(), 1e-6f);
+
+        // The output starts from zero at the edge of the dead zone rather than jumping to the dead zone's value
+        const AZ::Vector2 edge = GamepadInputProcessor::ApplyRadialDeadZone(AZ::Vector2(0.f, 0.16f), 0.15f, 0.95f);
+        EXPECT_NEAR(edge.GetY(), 0.01f / 0.8f, 1e-5f);
+
+        const AZ::Vector2 curved = GamepadInputProcessor::ApplyResponseCurve(AZ::Vector2(-0.5f, 0.f), 2.f);
+        EXPECT_NEAR(curved.GetX(), -0.25f, 1e-6f);
+        EXPECT_FLOAT_EQ(curved.GetY(), 0.f);
+    }
+
+    TEST_F(GamepadInputTest, MoveInputFollowsAStrafeTrace)
+    {
+        // The left stick pushed to the right while drifting slightly up, then released
+        const AZStd::vector<AZ::Vector2> trace = { { 0.2f, 0.05f }, { 0.55f, 0.06f }, { 0.9f, 0.08f }, { 1.f, 0.07f }, { 0.4f, 0.03f }, { 0.f, 0.f } };
+
+        const GamepadInputSettings settings;
+        GamepadInputProcessor processor;
+        float prevRight = 0.f;
+        for(size_t i = 0; i < 4; ++i)
+        {
+            const AZ::Vector2 move = processor.GetMoveInput(settings, trace[i]);
+            EXPECT_GT(move.GetX(), prevRight);
+            EXPECT_LE(move.GetLength(), 1.f);
+            prevRight = move.GetX();
+        }
+        EXPECT_NEAR(prevRight, 1.f, 1e-2f);
+        EXPECT_TRUE(processor.GetMoveInput(settings, trace.back()).IsZero());
+    }
+
+    TEST_F(GamepadInputTest, CenteredStickKeepsTheHeldKeyboardInput)
+    {
+        // W is held throughout while the left stick is pushed back and to the right, then released. The keyboard's
+        // input values aren't refreshed while the key is held, so each tick combines the stick with the same values.
+        const AZStd::vector<AZ::Vector2> trace = { { 0.f, 0.f }, { 0.5f, -0.6f }, { 1.f, -1.f }, { 0.3f, -0.2f }, { 0.f, 0.f } };
+        const float keyboardForward = 1.f;
+
+        const GamepadInputSettings settings;
+        GamepadInputProcessor processor;
+        for(const AZ::Vector2& sample : trace)
+        {
+            const AZ::Vector2 move = processor.GetMoveInput(settings, sample);
+            float forward = keyboardForward, back = 0.f, left = 0.f, right = 0.f;
+            GamepadInputProcessor::CombineMoveInput(move, forward, back, left, right);
+
+            EXPECT_FLOAT_EQ(forward, keyboardForward);
+            EXPECT_FLOAT_EQ(back, AZ::GetMax(-move.GetY(), 0.f));
+            EXPECT_FLOAT_EQ(right, AZ::GetMax(move.GetX(), 0.f));
+            EXPECT_FLOAT_EQ(left, 0.f);
+        }
+
+        // A partially pressed key loses to a stick deflected further in the same direction
+        float forward = 0.25f, back = 0.f, left = 0.f, right = 0.f;
+        GamepadInputProcessor::CombineMoveInput(AZ::Vector2(0.f, 0.75f), forward, back, left, right);
+        EXPECT_FLOAT_EQ(forward, 0.75f);
+    }
+
+    TEST_F(GamepadInputTest, LookTraceRotatesTheSameAtAnyFrameRate)
+    {
+        // A flick of the right stick to the right, held past the acceleration time, then released
+        AZStd::vector<AZ::Vector2> trace = { { 0.f, 0.f }, { 0.35f, 0.02f }, { 0.7f, 0.04f }, { 0.95f, 0.03f } };
+        for(int i = 0; i < 60; ++i)
+            trace.push_back({ 1.f, 0.02f });
+        trace.push_back({ 0.5f, 0.f });
+        trace.push_back({ 0.f, 0.f });
+
+        const GamepadInputSettings settings;
+        const AZ::Vector2 rotation60 = ReplayLook(settings, trace, 1);
+        const AZ::Vector2 rotation240 = ReplayLook(settings, trace, 4);
+
+        EXPECT_GT(rotation60.GetX(), 0.f);
+        EXPECT_NEAR(rotation240.GetX(), rotation60.GetX(), rotation60.GetX() * 0.02f);
+        EXPECT_NEAR(rotation240.GetY(), rotation60.GetY(), rotation60.GetY() * 0.02f);
+
+        // Held for a second at full deflection, the rotation lies between the base rate and the fully accelerated rate
+        const float baseYaw = AZ::DegToRad(settings.m_lookYawSpeed);
+        EXPECT_GT(rotation60.GetX(), baseYaw);
+        EXPECT_LT(rotation60.GetX(), baseYaw * settings.m_lookAccelerationScale * 1.2f);
+    }
+
+    TEST_F(GamepadInputTest, LookAccelerationResetsWhenTheStickLeavesFullDeflection)
+    {
+        const GamepadInputSettings settings;
+        GamepadInputProcessor processor;
+        for(int i = 0; i < 60; ++i)
+            processor.UpdateLook(settings, AZ::Vector2(0.f, 1.f), TraceDeltaTime);
+        EXPECT_FLOAT_EQ(processor.GetLookAccelerationTime(), settings.m_lookAccelerationTime);
+
+        processor.UpdateLook(settings, AZ::Vector2(0.f, 0.6f), TraceDeltaTime);
+        EXPECT_FLOAT_EQ(processor.GetLookAccelerationTime(), 0.f);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Serializes and deserializes one snapshot per step, state.range(0) selects delta compression against the previous step
+    static void BM_ControllerSnapshotRoundTrip(benchmark::State& state)
+    {
+        const SnapshotQuantization quantization;
+        const bool useBaseline = state.range(0) != 0;
+
+        ControllerSnapshot baseline = CreateMovingSnapshot();
+        ControllerSnapshot snapshot = baseline;
+        AZStd::vector<AZ::u8> buffer;
+        buffer.reserve(64);
+        size_t totalBytes = 0;
+
+        for([[maybe_unused]] auto _ : state)
+        {
+            snapshot.m_applyVelocityZ -= 0.16f;
+            if(snapshot.m_applyVelocityZ < -quantization.m_velocityRange)
+                snapshot.m_applyVelocityZ = 0.f;
+
+            buffer.clear();
+            BitWriter writer(buffer);
+            ControllerSnapshotSerializer::Serialize(snapshot, useBaseline ? &baseline : nullptr, quantization, writer);
+
+            ControllerSnapshot result;
+            BitReader reader(buffer.data(), static_cast<AZ::u32>(buffer.size()));
+            ControllerSnapshotSerializer::Deserialize(result, useBaseline ? &baseline : nullptr, quantization, reader);
+            benchmark::DoNotOptimize(result);
+
+            totalBytes += buffer.size();
+            baseline = snapshot;
+        }
+
+        state.counters["bytes/step"] = benchmark::Counter(static_cast<double>(totalBytes), benchmark::Counter::kAvgIterations);
+    }
+    BENCHMARK(BM_ControllerSnapshotRoundTrip)->Arg(0)->Arg(1)->Unit(benchmark::kNanosecond);
+
+    // Radius (state.range(0) == 0) or view cone (state.range(0) == 1) query over 10k interactables spread across a 200 m square.
+    static void BM_InteractableSpatialGridQuery(benchmark::State& state)
+    {
+        constexpr AZ::u32 InteractableCount = 10000;
+        const bool coneQuery = state.range(0) != 0;
+
+        InteractableSpatialGrid grid;
+        AZ::u32 seed = 12345;
+        for(AZ::u32 i = 0; i < InteractableCount; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const float x = static_cast<float>(seed % 20000) * 0.01f - 100.f;
+            seed = seed * 1664525u + 1013904223u;
+            const float y = static_cast<float>(seed % 20000) * 0.01f - 100.f;
+            grid.Insert(AZ::EntityId(i + 1), AZ::Vector3(x, y, static_cast<float>(i % 4)));
+        }
+
+        AZStd::vector<AZ::EntityId> results;
+        results.reserve(64);
+        size_t totalResults = 0;
+        float heading = 0.f;
+
+        for([[maybe_unused]] auto _ : state)
+        {
+            heading += 0.01f;
+            const AZ::Vector3 origin(AZStd::cos(heading) * 50.f, AZStd::sin(heading) * 50.f, 1.6f);
+
+            results.clear();
+            if(coneQuery)
+                grid.QueryCone(origin, AZ::Vector3(-AZStd::sin(heading), AZStd::cos(heading), 0.f), 3.f, AZ::Constants::Pi / 4.f, results);
+            else
+                grid.QueryRadius(origin, 3.f, results);
+            benchmark::DoNotOptimize(results.data());
+
+            totalResults += results.size();
+        }
+
+        state.counters["results/query"] = benchmark::Counter(static_cast<double>(totalResults), benchmark::Counter::kAvgIterations);
+    }
+    BENCHMARK(BM_InteractableSpatialGridQuery)->Arg(0)->Arg(1)->Unit(benchmark::kNanosecond);
+
+    namespace
+    {
+        // Controller whose notification is being sent, which a broadcast handler has to compare against its own
+        AZ::EntityId s_notifyingControllerId;
+
+        // Stands in for a scripted handler that only reacts to the ground hits of the controller it is connected to
+        class GroundHitListener
+            : public FirstPersonControllerNotificationBus::Handler
+        {
+        public:
+            explicit GroundHitListener(const AZ::EntityId& controllerId)
+                : m_controllerId(controllerId)
+            {
+                FirstPersonControllerNotificationBus::Handler::BusConnect(controllerId);
+            }
+            ~GroundHitListener() override
+            {
+                FirstPersonControllerNotificationBus::Handler::BusDisconnect();
+            }
+
+            void OnGroundHit() override
+            {
+                ++m_calls;
+                if(s_notifyingControllerId == m_controllerId)
+                    ++m_groundHits;
+            }
+            void OnGroundSoonHit() override {}
+            void OnUngrounded() override {}
+            void OnStartedFalling() override {}
+            void OnStartedMoving() override {}
+            void OnTargetVelocityReached() override {}
+            void OnStopped() override {}
+            void OnTopWalkSpeedReached() override {}
+            void OnTopSprintSpeedReached() override {}
+            void OnHeadHit() override {}
+            void OnHitSomething() override {}
+            void OnGravityPrevented() override {}
+            void OnCrouched() override {}
+            void OnStoodUp() override {}
+            void OnStandPrevented() override {}
+            void OnStartedCrouching() override {}
+            void OnStartedStanding() override {}
+            void OnFirstJump() override {}
+            void OnSecondJump() override {}
+            void OnStaminaCapped() override {}
+            void OnStaminaReachedZero() override {}
+            void OnSprintStarted() override {}
+            void OnCooldownStarted() override {}
+            void OnCooldownDone() override {}
+            void OnStartedClimbing() override {}
+            void OnStoppedClimbing() override {}
+
+            AZ::EntityId m_controllerId;
+            size_t m_calls = 0;
+            size_t m_groundHits = 0;
+        };
+    } // namespace
+
+    // One OnGroundHit from each of 100 controllers per step, heard by 20 handlers spread across the controllers.
+    // state.range(0) == 1 broadcasts as with Broadcast Notifications enabled, 0 addresses the controller's entity.
+    static void BM_ControllerNotificationDispatch(benchmark::State& state)
+    {
+        constexpr AZ::u32 ControllerCount = 100;
+        constexpr AZ::u32 ListenerCount = 20;
+        const bool broadcast = state.range(0) != 0;
+
+        AZStd::vector<AZ::EntityId> controllerIds;
+        controllerIds.reserve(ControllerCount);
+        for(AZ::u32 i = 0; i < ControllerCount; ++i)
+            controllerIds.push_back(AZ::EntityId(i + 1));
+
+        AZStd::vector<AZStd::unique_ptr<GroundHitListener>> listeners;
+        listeners.reserve(ListenerCount);
+        for(AZ::u32 i = 0; i < ListenerCount; ++i)
+            listeners.push_back(AZStd::make_unique<GroundHitListener>(controllerIds[i * (ControllerCount / ListenerCount)]));
+
+        for([[maybe_unused]] auto _ : state)
+        {
+            for(const AZ::EntityId& controllerId : controllerIds)
+            {
+                s_notifyingControllerId = controllerId;
+                if(broadcast)
+                    FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotifications::OnGroundHit);
+                else
+                    FirstPersonControllerNotificationBus::Event(controllerId, &FirstPersonControllerNotifications::OnGroundHit);
+            }
+        }
+
+        size_t totalCalls = 0;
+        size_t totalGroundHits = 0;
+        for(const auto& listener : listeners)
+        {
+            totalCalls += listener->m_calls;
+            totalGroundHits += listener->m_groundHits;
+        }
+        listeners.clear();
+
+        state.counters["handler calls/step"] = benchmark::Counter(static_cast<double>(totalCalls), benchmark::Counter::kAvgIterations);
+        state.counters["ground hits/step"] = benchmark::Counter(static_cast<double>(totalGroundHits), benchmark::Counter::kAvgIterations);
+    }
+    BENCHMARK(BM_ControllerNotificationDispatch)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+    // One scheduler tick of state.range(0) probing controllers in a single scene, with the query phase split into jobs of
+    // 16 controllers over state.range(1) job workers. Zero workers steps serially. Real time is reported since the jobs
+    // don't count towards the CPU time of the benchmark thread.
+    static void BM_ControllerStepSchedulerTick(benchmark::State& state)
+    {
+        const AZ::u32 controllerCount = static_cast<AZ::u32>(state.range(0));
+        const AZ::u32 workerCount = static_cast<AZ::u32>(state.range(1));
+
+        InteractableSpatialGrid obstacles;
+        ControllerStepSchedulerTest::CreateObstacles(obstacles, 10000, 100.f);
+
+        AZStd::vector<AZ::Vector3> endLog;
+        endLog.reserve(controllerCount);
+        AZStd::vector<AZStd::unique_ptr<ControllerStepSchedulerTest::ProbingController>> controllers;
+        ControllerStepSchedulerTest::CreateControllers(controllers, controllerCount, obstacles, endLog);
+
+        AZStd::unique_ptr<ControllerStepSchedulerTest::ScopedJobContext> jobContext;
+        if(workerCount > 0)
+            jobContext = AZStd::make_unique<ControllerStepSchedulerTest::ScopedJobContext>(workerCount);
+
+        ControllerStepScheduler scheduler;
+        scheduler.SetParallelSceneStepping(workerCount > 0);
+        scheduler.SetControllersPerJob(16);
+        for(const auto& controller : controllers)
+            scheduler.AddController(controller.get(), ControllerStepSchedulerTest::GetSceneHandle(0), false);
+
+        size_t queryPhaseMicroseconds = 0;
+        for([[maybe_unused]] auto _ : state)
+        {
+            endLog.clear();
+            scheduler.Tick(ControllerStepSchedulerTest::DeltaTime);
+            queryPhaseMicroseconds += scheduler.GetLastQueryPhaseMicroseconds();
+        }
+        scheduler.Clear();
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * controllerCount);
+        state.counters["query phase us"] = benchmark::Counter(static_cast<double>(queryPhaseMicroseconds), benchmark::Counter::kAvgIterations);
+    }
+    BENCHMARK(BM_ControllerStepSchedulerTick)
+        ->ArgNames({ "controllers", "workers" })
+        ->ArgsProduct({ { 64, 256, 1024 }, { 0, 1, 2, 4, 8 } })
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+#endif
+} // namespace UnitTest
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -1,5 +1,16 @@
 
 set(FILES
+    Include/FirstPersonController/CharacterTeleportBus.h
     Include/FirstPersonController/FirstPersonControllerBus.h
     Include/FirstPersonController/FirstPersonControllerComponentBus.h
+    Include/FirstPersonController/FirstPersonControllerNetworkComponentBus.h
+    Include/FirstPersonController/FirstPersonInteractionComponentBus.h
+    Include/FirstPersonController/GrabbableComponentBus.h
+    Include/FirstPersonController/ImpulsePadComponentBus.h
+    Include/FirstPersonController/InputOverride.h
+    Include/FirstPersonController/InteractableRegistryBus.h
+    Include/FirstPersonController/KinematicMoverComponentBus.h
+    Include/FirstPersonController/LodTier.h
+    Include/FirstPersonController/LadderComponentBus.h
+    Include/FirstPersonController/TagIndexBus.h
 )
@@ -3,6 +3,56 @@ set(FILES
     Source/FirstPersonControllerModuleInterface.h
     Source/Clients/FirstPersonControllerSystemComponent.cpp
     Source/Clients/FirstPersonControllerSystemComponent.h
+    Source/Clients/CharacterTeleporter.cpp
+    Source/Clients/CharacterTeleporter.h
+    Source/Clients/ControllerLod.cpp
+    Source/Clients/ControllerLod.h
+    Source/Clients/ControllerStepInputBus.h
+    Source/Clients/ControllerStepScheduler.cpp
+    Source/Clients/ControllerStepScheduler.h
+    Source/Clients/DeferredEventQueue.h
     Source/Clients/FirstPersonControllerComponent.cpp
     Source/Clients/FirstPersonControllerComponent.h
+    Source/Clients/FirstPersonControllerNetworkComponent.cpp
+    Source/Clients/FirstPersonControllerNetworkComponent.h
+    Source/Clients/FirstPersonControllerSerializer.cpp
+    Source/Clients/FirstPersonControllerSerializer.h
+    Source/Clients/FirstPersonCarryComponent.cpp
+    Source/Clients/FirstPersonCarryComponent.h
+    Source/Clients/FirstPersonInteractionComponent.cpp
+    Source/Clients/FirstPersonInteractionComponent.h
+    Source/Clients/GamepadInput.cpp
+    Source/Clients/GamepadInput.h
+    Source/Clients/GrabbableComponent.cpp
+    Source/Clients/GrabbableComponent.h
+    Source/Clients/ImpulsePadComponent.cpp
+    Source/Clients/ImpulsePadComponent.h
+    Source/Clients/ImpulsePadResponse.cpp
+    Source/Clients/ImpulsePadResponse.h
+    Source/Clients/InputOverrideStack.cpp
+    Source/Clients/InputOverrideStack.h
+    Source/Clients/InteractHold.cpp
+    Source/Clients/InteractHold.h
+    Source/Clients/InteractableComponent.cpp
+    Source/Clients/InteractableComponent.h
+    Source/Clients/InteractableSpatialGrid.cpp
+    Source/Clients/InteractableSpatialGrid.h
+    Source/Clients/KinematicMoverComponent.cpp
+    Source/Clients/KinematicMoverComponent.h
+    Source/Clients/KinematicMoverSystem.cpp
+    Source/Clients/KinematicMoverSystem.h
+    Source/Clients/LadderComponent.cpp
+    Source/Clients/LadderComponent.h
+    Source/Clients/NetworkPrediction.cpp
+    Source/Clients/NetworkPrediction.h
+    Source/Clients/PhysicsSceneLookup.cpp
+    Source/Clients/PhysicsSceneLookup.h
+    Source/Clients/PlatformVelocity.cpp
+    Source/Clients/PlatformVelocity.h
+    Source/Clients/TagIndex.cpp
+    Source/Clients/TagIndex.h
+    Source/Clients/TeleporterComponent.cpp
+    Source/Clients/TeleporterComponent.h
+    Source/Clients/VerticalVelocity.cpp
+    Source/Clients/VerticalVelocity.h
 )